@@ -0,0 +1,1109 @@
+// engine.h
+// Header-only job matching engine shared by the array and linked list programs.
+//
+//   Engine<Storage, Search, Sort>
+//     Storage  ArrayStorage | LinkedListStorage       (engine_policies.h)
+//     Search   LinearSearch | BinarySearch | SentinelSearch
+//     Sort     QuickSort | MergeSort | RadixMergeSort
+//
+// Each program is a thin instantiation, e.g. array_listA.cpp:
+//   Engine<ArrayStorage, LinearSearch, QuickSort> engine;
+//   return engine.run(argc, argv);
+//
+// Flow: load jobs, load resumes, sort jobs (title asc), sort resumes (skill count
+// desc), build the skill and title indexes, then the per-job aggregates (see
+// JobAggregates), then the interactive menu. With --background the menu opens
+// first and the aggregates follow on their own thread.
+//
+#ifndef ENGINE_H
+#define ENGINE_H
+
+#include <atomic>
+#include <limits>
+#include <thread>
+#include "engine_common.h"
+#include "engine_policies.h"
+#include "posting_lists.h"
+#include "result_cache.h"
+#include "score_kernels.h"
+#include "title_index.h"
+#include "thread_pool.h"
+
+const int LOAD_GRAIN = 512; // records per parallel loader task
+const int JOB_GRAIN = 8;     // jobs per parallel query task
+
+// Per-thread query buffers, so jobs can be evaluated concurrently
+struct QueryScratch {
+    unsigned long long* bits;            // all-zero bitmap over resume groups, for unions
+    DynArray<int> candidates;            // resume groups sharing a skill with the job
+    ScoreCacheStats cacheStats;
+};
+
+// Per-job values derived from the finished index: built once, published
+// through Engine::aggregates, then only read. Until then searches compute
+// what they need on the fly.
+struct JobAggregates {
+    int* jobCandidates;   // matched candidates per job position
+    TitleTrie titleTrie;  // Job::titleNorm prefixes, ranked by jobCandidates
+    JobCount* jobStats;   // evaluateJob() per job position, with --precompute
+    int* scoreHistogram;  // [pos * (MAX_SCORE + 1) + score] matched resumes, with --precompute
+    long long readyMs;    // since program start
+
+    void destroy() {
+        delete[] jobCandidates;
+        titleTrie.destroy();
+        delete[] jobStats;
+        delete[] scoreHistogram;
+    }
+};
+
+template <class Storage, class Search, class Sort>
+class Engine {
+public:
+    typedef typename Storage::template Table<Job> JobTable;
+    typedef typename Storage::template Table<Resume> ResumeTable;
+    typedef typename Storage::template Table<CandidateScore> ScoreTable;
+    typedef typename Storage::template Table<JobCount> JobCountTable;
+
+    int run(int argc, char* argv[]);
+
+private:
+    JobTable jobs;
+    ResumeTable resumes;
+    ResumeIdIndex resumeIds;       // id -> resume, built by the loader
+    ScoreTable scores;             // scratch list for candidate / job scores
+    JobCountTable jobCounts;       // scratch list for per-job counts
+
+    TitleDictionary titleBases;    // ranked base titles for Job::titleKey
+    SkillDictionary skillDict;     // skill norm -> id
+    DynArray<int> jobSkillPool;    // every Job::skillIds run, back to back
+    DynArray<int> resumeSkillPool; // every Resume::skillIds run, back to back
+    TitleGramIndex titleGrams;     // trigrams of Job::titleNorm -> positions in title order
+    std::atomic<JobAggregates*> aggregates; // null until built
+    std::thread warmer;                     // builds aggregates with --background
+    std::atomic<bool> stopWarmUp;
+    ResumeGroups resumeGroups;            // resumes by skill set, numbered in sorted order
+    RoaringPostings resumeSets;           // inverted index: skill id -> resume groups
+    ScoreCache scoreCache;                // (Job::signature, resume group) -> score
+    LruCache<SearchResult> resultCache;   // "t:" / "s:" / "c:" + normalized query -> results
+    int* resumesPerSkill;                 // resumes (not groups) per skill id
+    CompressedPostings jobPostings;       // inverted index: skill id -> job positions, once per occurrence
+    const Job** jobByPos;          // jobs in title order
+    int* jobMatches;               // candidate query accumulator, indexed by Job::pos
+    DynArray<int> touchedJobs;     // positions with jobMatches > 0
+    DynArray<int> titleHits;       // partial title search positions
+    QueryScratch* scratch;         // one per pool thread
+    int unionWords;                // QueryScratch::bits length
+
+    DynArray<const Job*> jobHits;
+    DynArray<JobCount> evaluated;  // evaluateJobs() output, one slot per job
+
+    OutputSink resultSink;
+    EngineOptions options;
+    ThreadPool pool;               // options.threads threads, including the main one
+    std::chrono::high_resolution_clock::time_point globalStart;
+
+    // ------------------- LOADING -------------------
+    int loadJobs(const std::string& filename);
+    int loadResumes(const std::string& filename);
+    template <class T>
+    void assignSkillIds(DynArray<T*>& loaded, bool distinct, DynArray<int>& idPool);
+    void buildIndex();
+    void initScratch(QueryScratch& qs);
+    void destroyScratch(QueryScratch& qs);
+
+    // ------------------- MATCH / SCORE -------------------
+    void getCandidatesForJob(const Job& job, QueryScratch& qs);
+    void evaluateJob(const Job& job, QueryScratch& qs, JobCount& out, int* histogram = nullptr);
+    void evaluateJobs(const Job* const* list, int n);
+    JobAggregates* buildAggregates(bool onPool);
+    void reportAggregates(const JobAggregates& a);
+    void startWarmUp();
+    int topScoreThreshold(const JobAggregates* a, const Job& job) const;
+
+    const std::string& titleAt(int pos) const { return jobByPos[pos]->titleNorm; }
+
+    // ------------------- OUTPUT -------------------
+    void printFirstNJobs(int N);
+    void printFirstNResumes(int N);
+    static std::string menuBanner();
+
+    // ------------------- SEARCHES -------------------
+    void searchByJobTitle(const std::string& queryRaw);
+    void searchBySkill(const std::string& skillRaw);
+    void searchByCandidateID(int candId);
+    void computeTitleSearch(const std::string& queryRaw, SearchResult& out);
+    void computeSkillSearch(const std::string& skillNorm, SearchResult& out);
+    void computeCandidateSearch(int candId, SearchResult& out);
+    void suggestJobTitles(const std::string& prefixRaw);
+    void printCacheStats();
+
+    void cleanup();
+};
+
+// ------------------- LOADING -------------------
+template <class Storage, class Search, class Sort>
+int Engine<Storage, Search, Sort>::loadJobs(const std::string& filename) {
+    std::ifstream fin(filename);
+    if (!fin.is_open()) {
+        std::cerr << "Error: cannot open job file '" << filename << "'\n";
+        return 0;
+    }
+    std::string line;
+    if (!std::getline(fin, line)) return 0; // header
+
+    // Base ranks are known only once every title is seen: keep each job's base
+    // and number until then
+    DynArray<std::string> jobBases;
+    jobBases.init(1024);
+    DynArray<Job*> loaded;
+    loaded.init(1024);
+    std::string base;
+    bool hasNumber;
+    unsigned long long number;
+    while (std::getline(fin, line)) {
+        if (trim(line).empty()) continue;
+        size_t pos = 0;
+        std::string field1, field2;
+        if (!extractQuotedField(line, pos, field1)) continue;
+        extractQuotedField(line, pos, field2);
+        Job* job = jobs.append();
+        if (!job) break; // storage full
+        job->titleOriginal = trim(field1);
+        job->titleNorm = normalizeKey(job->titleOriginal);
+        splitTitle(job->titleOriginal, base, hasNumber, number);
+        job->titleKey = packTitleKey(0, hasNumber, number);
+        job->skillsOriginal = trim(field2);
+        titleBases.add(base);
+        jobBases.push(base);
+        loaded.push(job);
+    }
+
+    titleBases.finalize();
+    for (int i = 0; i < loaded.size; ++i) {
+        loaded.data[i]->titleKey |= packTitleKey(titleBases.rank(jobBases.data[i]), false, 0);
+    }
+
+    // Skill parsing is independent per job
+    pool.parallelFor(0, loaded.size, LOAD_GRAIN, [&](int lo, int hi, int) {
+        for (int i = lo; i < hi; ++i) {
+            Job* job = loaded.data[i];
+            job->skillCount = buildSkillArray(job->skillsOriginal, job->skills);
+        }
+    });
+    assignSkillIds(loaded, false, jobSkillPool);
+    jobBases.destroy();
+    loaded.destroy();
+    return jobs.size();
+}
+
+template <class Storage, class Search, class Sort>
+int Engine<Storage, Search, Sort>::loadResumes(const std::string& filename) {
+    std::ifstream fin(filename);
+    if (!fin.is_open()) {
+        std::cerr << "Error: cannot open resume file '" << filename << "'\n";
+        return 0;
+    }
+    std::string line;
+    std::getline(fin, line); // two header lines
+    std::getline(fin, line);
+    int id = 1;
+    DynArray<Resume*> loaded;
+    loaded.init(1024);
+    while (std::getline(fin, line)) {
+        size_t pos = 0;
+        std::string skills;
+        extractQuotedField(line, pos, skills);
+        Resume* r = resumes.append();
+        if (!r) break; // storage full
+        r->id = id++;
+        r->skillsOriginal = trim(skills);
+        loaded.push(r);
+    }
+
+    // Skill parsing is independent per resume
+    pool.parallelFor(0, loaded.size, LOAD_GRAIN, [&](int lo, int hi, int) {
+        for (int i = lo; i < hi; ++i) {
+            Resume* r = loaded.data[i];
+            r->skillCount = buildSkillArray(r->skillsOriginal, r->skills);
+        }
+    });
+    assignSkillIds(loaded, true, resumeSkillPool);
+    resumeIds.build(loaded.data, loaded.size);
+    loaded.destroy();
+    return resumes.size();
+}
+
+// Interns the parsed skills (serially: ids are handed out in file order) and
+// stores each record's sorted ids in 'idPool'. The pool grows while it fills,
+// so the pointers are set once it is complete.
+template <class Storage, class Search, class Sort>
+template <class T>
+void Engine<Storage, Search, Sort>::assignSkillIds(DynArray<T*>& loaded, bool distinct, DynArray<int>& idPool) {
+    DynArray<int> starts;
+    starts.init(loaded.size);
+    for (int i = 0; i < loaded.size; ++i) {
+        T* rec = loaded.data[i];
+        starts.push(idPool.size);
+        rec->skillIdCount = appendSkillIds(skillDict, rec->skills, rec->skillCount, distinct, idPool);
+    }
+    for (int i = 0; i < loaded.size; ++i) loaded.data[i]->skillIds = idPool.data + starts.data[i];
+    starts.destroy();
+}
+
+// Runs after the resume sort, so each posting list follows the sorted order.
+template <class Storage, class Search, class Sort>
+void Engine<Storage, Search, Sort>::buildIndex() {
+    resultCache.clear(); // cached results point into the data being indexed
+
+    // Resumes sharing a skill set share one group. Groups are numbered in the
+    // sorted resume order, so every posting list of groups is ascending
+    const Resume** ordered = new const Resume*[resumes.size() > 0 ? resumes.size() : 1];
+    int n = 0;
+    for (auto c = resumes.begin(); resumes.valid(c); c = resumes.next(c)) ordered[n++] = &resumes.at(c);
+    resumeGroups.build(ordered, n);
+    delete[] ordered;
+
+    // List l holds the groups with skill id l: count, prefix sums, fill
+    int skillCount = skillDict.size();
+    int* listStart = new int[skillCount + 1];
+    resumesPerSkill = new int[skillCount > 0 ? skillCount : 1];
+    for (int l = 0; l <= skillCount; ++l) listStart[l] = 0;
+    for (int l = 0; l < skillCount; ++l) resumesPerSkill[l] = 0;
+    int totalSkillsIndexed = 0;
+    for (int g = 0; g < resumeGroups.count; ++g) {
+        const ResumeGroup& grp = resumeGroups.groups[g];
+        for (int s = 0; s < grp.skillIdCount; ++s) {
+            ++listStart[grp.skillIds[s] + 1];
+            resumesPerSkill[grp.skillIds[s]] += grp.size;
+        }
+        totalSkillsIndexed += grp.size * grp.skillIdCount;
+    }
+    for (int l = 0; l < skillCount; ++l) listStart[l + 1] += listStart[l];
+    int* values = new int[listStart[skillCount] > 0 ? listStart[skillCount] : 1];
+    int* fill = new int[skillCount > 0 ? skillCount : 1];
+    for (int l = 0; l < skillCount; ++l) fill[l] = listStart[l];
+    for (int g = 0; g < resumeGroups.count; ++g) {
+        const ResumeGroup& grp = resumeGroups.groups[g];
+        for (int s = 0; s < grp.skillIdCount; ++s) values[fill[grp.skillIds[s]]++] = g;
+    }
+    resumeSets.build(values, listStart, skillCount);
+    delete[] values;
+    std::cout << "Grouped " << n << " resumes into " << resumeGroups.count << " distinct skill sets.\n";
+
+    // Bitmap containers cover whole 64K chunks, so the union bitmaps do too
+    unionWords = ((resumeGroups.count + 65535) >> 16) * ROARING_BITMAP_WORDS;
+    scratch = new QueryScratch[pool.size()];
+    for (int w = 0; w < pool.size(); ++w) initScratch(scratch[w]);
+
+    // List l holds the positions of the jobs with skill id l, the same way.
+    // Jobs are already in title order, so every posting list is too
+    for (int l = 0; l <= skillCount; ++l) listStart[l] = 0;
+    titleGrams.init();
+    jobByPos = new const Job*[jobs.size() > 0 ? jobs.size() : 1];
+    jobMatches = new int[jobs.size() > 0 ? jobs.size() : 1];
+    SignatureTable jobSignatures;
+    jobSignatures.init(jobs.size());
+    int pos = 0;
+    for (auto c = jobs.begin(); jobs.valid(c); c = jobs.next(c), ++pos) {
+        Job& job = jobs.at(c);
+        job.pos = pos;
+        job.signature = jobSignatures.intern(job.skillIds, job.skillIdCount, job.skillCount);
+        jobByPos[pos] = &job;
+        jobMatches[pos] = 0;
+        titleGrams.add(job.titleNorm, pos);
+        for (int s = 0; s < job.skillIdCount; ++s) ++listStart[job.skillIds[s] + 1];
+        totalSkillsIndexed += job.skillIdCount;
+    }
+    scoreCache.reset(jobSignatures.size(), resumeGroups.count);
+    long long cacheCells = (long long)jobSignatures.size() * resumeGroups.count;
+    std::cout << "Score cache: " << jobSignatures.size() << " job skill sets x " << resumeGroups.count << " resume skill sets"
+              << (cacheCells == 0 ? " (empty)" : cacheCells > SCORE_CACHE_MAX_CELLS ? " (too large, not cached)" : "")
+              << ".\n";
+    jobSignatures.destroy();
+    for (int l = 0; l < skillCount; ++l) listStart[l + 1] += listStart[l];
+    values = new int[listStart[skillCount] > 0 ? listStart[skillCount] : 1];
+    for (int l = 0; l < skillCount; ++l) fill[l] = listStart[l];
+    for (int p = 0; p < pos; ++p) {
+        const Job& job = *jobByPos[p];
+        for (int s = 0; s < job.skillIdCount; ++s) values[fill[job.skillIds[s]]++] = p;
+    }
+    jobPostings.build(values, listStart, skillCount);
+    delete[] fill;
+    delete[] values;
+    delete[] listStart;
+    std::cout << "Indexed " << totalSkillsIndexed << " skill entries ("
+              << (resumeSets.memoryBytes() + jobPostings.memoryBytes()) / 1024 << " KB of postings).\n";
+}
+
+template <class Storage, class Search, class Sort>
+void Engine<Storage, Search, Sort>::initScratch(QueryScratch& qs) {
+    qs.bits = new unsigned long long[unionWords];
+    for (int i = 0; i < unionWords; ++i) qs.bits[i] = 0;
+    qs.candidates.init(256);
+    qs.cacheStats = ScoreCacheStats{0, 0};
+}
+
+template <class Storage, class Search, class Sort>
+void Engine<Storage, Search, Sort>::destroyScratch(QueryScratch& qs) {
+    delete[] qs.bits;
+    qs.candidates.destroy();
+}
+
+// Candidate counts and the title trie they rank, plus with --precompute every
+// job's counts, best candidate and score histogram. onPool spreads the jobs
+// over the pool; otherwise they run on the calling thread with its own
+// scratch, and stopWarmUp abandons the build (returns null).
+template <class Storage, class Search, class Sort>
+JobAggregates* Engine<Storage, Search, Sort>::buildAggregates(bool onPool) {
+    int n = jobs.size();
+    JobAggregates* a = new JobAggregates;
+    a->jobCandidates = new int[n > 0 ? n : 1];
+    a->titleTrie.init();
+    a->jobStats = options.precompute ? new JobCount[n > 0 ? n : 1] : nullptr;
+    a->scoreHistogram = options.precompute ? new int[(long long)(n > 0 ? n : 1) * (MAX_SCORE + 1)] : nullptr;
+
+    auto evaluateRange = [&](int lo, int hi, QueryScratch& qs) {
+        for (int p = lo; p < hi; ++p) {
+            if (a->jobStats) {
+                int* histogram = a->scoreHistogram + (long long)p * (MAX_SCORE + 1);
+                for (int s = 0; s <= MAX_SCORE; ++s) histogram[s] = 0;
+                evaluateJob(*jobByPos[p], qs, a->jobStats[p], histogram); // leaves the candidates in qs
+            } else {
+                getCandidatesForJob(*jobByPos[p], qs);
+            }
+            int total = 0;
+            for (int i = 0; i < qs.candidates.size; ++i) total += resumeGroups.groups[qs.candidates.data[i]].size;
+            a->jobCandidates[p] = total;
+        }
+    };
+    if (onPool) {
+        pool.parallelFor(0, n, JOB_GRAIN, [&](int lo, int hi, int worker) { evaluateRange(lo, hi, scratch[worker]); });
+    } else {
+        QueryScratch own;
+        initScratch(own);
+        for (int lo = 0; lo < n && !stopWarmUp.load(std::memory_order_relaxed); lo += JOB_GRAIN) {
+            evaluateRange(lo, lo + JOB_GRAIN < n ? lo + JOB_GRAIN : n, own);
+        }
+        destroyScratch(own);
+        if (stopWarmUp.load(std::memory_order_relaxed)) {
+            a->destroy();
+            delete a;
+            return nullptr;
+        }
+    }
+
+    a->titleTrie.build(n,
+                       [this](int p) -> const std::string& { return titleAt(p); },
+                       [a](int p) { return a->jobCandidates[p]; });
+    a->readyMs = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::high_resolution_clock::now() - globalStart).count();
+    return a;
+}
+
+template <class Storage, class Search, class Sort>
+void Engine<Storage, Search, Sort>::reportAggregates(const JobAggregates& a) {
+    std::cout << "Indexed " << a.titleTrie.nodes.size << " title prefixes.\n";
+    if (a.jobStats) std::cout << "Precomputed match statistics for " << jobs.size() << " jobs.\n";
+}
+
+// Builds the aggregates on a thread of its own while the menu runs; the
+// release store pairs with the searches' acquire loads
+template <class Storage, class Search, class Sort>
+void Engine<Storage, Search, Sort>::startWarmUp() {
+    stopWarmUp.store(false);
+    warmer = std::thread([this]() {
+        JobAggregates* a = buildAggregates(false);
+        if (a) aggregates.store(a, std::memory_order_release);
+    });
+}
+
+// ------------------- MATCH / SCORE -------------------
+// Resume groups sharing at least one skill with the job, each listed once
+template <class Storage, class Search, class Sort>
+void Engine<Storage, Search, Sort>::getCandidatesForJob(const Job& job, QueryScratch& qs) {
+    DynArray<int>& candidates = qs.candidates;
+    candidates.clear();
+    // Job ids are sorted, so a repeated skill is a repeated neighbour
+    int lists[MAX_SKILLS];
+    int k = 0;
+    for (int i = 0; i < job.skillIdCount; ++i) {
+        if (k == 0 || lists[k - 1] != job.skillIds[i]) lists[k++] = job.skillIds[i];
+    }
+    resumeSets.unionOf(lists, k, qs.bits, [&](int g) { candidates.push(g); });
+}
+
+// Matched candidates (score > 0) and the best of them for one job; histogram,
+// if given, gets the matched resumes per score
+template <class Storage, class Search, class Sort>
+void Engine<Storage, Search, Sort>::evaluateJob(const Job& job, QueryScratch& qs, JobCount& out, int* histogram) {
+    ScoreKernel score = scoreKernelFor(job); // chosen once per job, not per candidate
+    getCandidatesForJob(job, qs);
+    int totalMatched = 0;
+    int bestId = 0;
+    int bestScore = -1;
+    for (int ci = 0; ci < qs.candidates.size; ++ci) {
+        int group = qs.candidates.data[ci];
+        const ResumeGroup& g = resumeGroups.groups[group];
+        int sc = scoreCache.get(job.signature, group, [&]() { return score(job, g); }, qs.cacheStats); // once for every member
+        if (sc > 0) {
+            totalMatched += g.size;
+            if (histogram) histogram[sc] += g.size;
+            // Candidate order depends on the union strategy; ties go to the lower id
+            if (sc > bestScore || (sc == bestScore && g.minId < bestId)) { bestScore = sc; bestId = g.minId; }
+        }
+    }
+    out.job = &job;
+    out.count = totalMatched;
+    out.bestCandidateId = bestId;
+    out.bestCandidateScore = bestScore;
+}
+
+// Fills evaluated[0..n) for list[0..n) on the pool; each thread uses its own
+// scratch. Precomputed stats are copied instead, once published.
+template <class Storage, class Search, class Sort>
+void Engine<Storage, Search, Sort>::evaluateJobs(const Job* const* list, int n) {
+    evaluated.clear();
+    const JobAggregates* a = aggregates.load(std::memory_order_acquire);
+    if (a && a->jobStats) {
+        for (int i = 0; i < n; ++i) evaluated.push(a->jobStats[list[i]->pos]);
+        return;
+    }
+    JobCount blank = {nullptr, 0, 0, -1};
+    for (int i = 0; i < n; ++i) evaluated.push(blank);
+    pool.parallelFor(0, n, JOB_GRAIN, [&](int lo, int hi, int worker) {
+        for (int i = lo; i < hi; ++i) evaluateJob(*list[i], scratch[worker], evaluated.data[i]);
+    });
+}
+
+// Lowest score still in the job's top TOP_CANDIDATES, from the histogram;
+// 1 (every match) without precomputed stats
+template <class Storage, class Search, class Sort>
+int Engine<Storage, Search, Sort>::topScoreThreshold(const JobAggregates* a, const Job& job) const {
+    if (!a || !a->jobStats) return 1;
+    const int* histogram = a->scoreHistogram + (long long)job.pos * (MAX_SCORE + 1);
+    int covered = 0;
+    for (int s = MAX_SCORE; s > 1; --s) {
+        covered += histogram[s];
+        if (covered >= TOP_CANDIDATES) return s;
+    }
+    return 1;
+}
+
+// ------------------- OUTPUT -------------------
+template <class Storage, class Search, class Sort>
+void Engine<Storage, Search, Sort>::printFirstNJobs(int N) {
+    int shown = 0;
+    for (auto c = jobs.begin(); jobs.valid(c) && shown < N; c = jobs.next(c), ++shown) {
+        const Job& j = jobs.at(c);
+        resultSink << (shown + 1) << ". " << j.titleOriginal << " | Skills: " << j.skillsOriginal << "\n";
+    }
+    if (shown == 0) resultSink << "(none)\n";
+    resultSink << "\n";
+}
+
+template <class Storage, class Search, class Sort>
+void Engine<Storage, Search, Sort>::printFirstNResumes(int N) {
+    int shown = 0;
+    for (auto c = resumes.begin(); resumes.valid(c) && shown < N; c = resumes.next(c), ++shown) {
+        const Resume& r = resumes.at(c);
+        resultSink << (shown + 1) << ". Resume ID: " << r.id << " | Skills count: " << r.skillCount << "\n";
+    }
+    if (shown == 0) resultSink << "(none)\n";
+    resultSink << "\n";
+}
+
+// "======= LINEAR SEARCH & QUICK SORT =======", centred to the MENU line width
+template <class Storage, class Search, class Sort>
+std::string Engine<Storage, Search, Sort>::menuBanner() {
+    const int WIDTH = 42;
+    std::string label = std::string(Search::name()) + " & " + Sort::name();
+    for (char& ch : label) ch = (char)toupper((unsigned char)ch);
+    int pad = WIDTH - (int)label.size() - 2;
+    if (pad < 2) pad = 2;
+    int left = pad / 2;
+    return std::string(left, '=') + " " + label + " " + std::string(pad - left, '=');
+}
+
+// ------------------- SEARCHES -------------------
+// Each search looks its normalized query up in the result cache, computes the
+// ranked lists on a miss, then prints them with the query as typed.
+template <class Storage, class Search, class Sort>
+void Engine<Storage, Search, Sort>::searchByJobTitle(const std::string& queryRaw) {
+    StepTimer timer;
+    timer.begin();
+
+    resultSink << "Searching for jobs matching '" << queryRaw << "'...\n";
+
+    std::string key = "t:" + titleQueryKey(queryRaw);
+    SearchResult* res = resultCache.find(key);
+    if (!res) {
+        res = resultCache.insert(key);
+        computeTitleSearch(queryRaw, *res);
+    }
+
+    int rcount = res->found;
+    resultSink << "Found " << rcount << " matching jobs.\n";
+
+    if (rcount == 0) {
+        resultSink << "No jobs found matching '" << queryRaw << "'.\n\n";
+        timer.finish(resultSink, globalStart);
+        printCacheStats();
+        return;
+    }
+
+    if (rcount > MAX_JOBS_TO_ANALYZE) {
+        resultSink << "NOTE: Found " << rcount << " jobs, analyzing first " << MAX_JOBS_TO_ANALYZE << " for performance.\n";
+        rcount = MAX_JOBS_TO_ANALYZE;
+    }
+    resultSink << "Analyzing candidates for " << rcount << " jobs...\n";
+    resultSink << "\nSorting results...\n";
+
+    for (int i = 0; i < res->jobs.size; ++i) {
+        const JobCount& jc = res->jobs.data[i];
+        resultSink << "\nJob: " << jc.job->titleOriginal << "\n";
+        resultSink << "Total matched candidates: " << jc.count << "\n";
+        resultSink << "Top " << TOP_CANDIDATES << " candidates:\n";
+        for (int c = res->scoreStart.data[i]; c < res->scoreStart.data[i + 1]; ++c) {
+            const CandidateScore& cs = res->scores.data[c];
+            resultSink << c - res->scoreStart.data[i] + 1 << ". candidate " << cs.id << " : " << cs.score << " score\n";
+        }
+    }
+    resultSink << "\n";
+
+    timer.finish(resultSink, globalStart);
+    printCacheStats();
+}
+
+// Matching jobs (exact title first, else titles containing the query), the
+// top MAX_JOBS_TO_DISPLAY by matched candidates and their top candidates
+template <class Storage, class Search, class Sort>
+void Engine<Storage, Search, Sort>::computeTitleSearch(const std::string& queryRaw, SearchResult& out) {
+    std::string qNorm = normalizeKey(queryRaw);
+    std::string qBase;
+    bool qHasNumber;
+    unsigned long long qNumber;
+    splitTitle(queryRaw, qBase, qHasNumber, qNumber);
+    int qRank = titleBases.rank(qBase);
+    jobHits.clear();
+    if (qRank >= 0) {
+        Search::findJobsExact(jobs, packTitleKey(qRank, qHasNumber, qNumber), jobHits);
+    }
+    if (jobHits.size == 0 && !qNorm.empty()) {
+        titleGrams.find(qNorm, jobs.size(), [this](int pos) -> const std::string& { return titleAt(pos); }, titleHits);
+        for (int i = 0; i < titleHits.size; ++i) jobHits.push(jobByPos[titleHits.data[i]]);
+    }
+
+    out.found = jobHits.size;
+    if (out.found == 0) return;
+    int rcount = out.found < MAX_JOBS_TO_ANALYZE ? out.found : MAX_JOBS_TO_ANALYZE;
+
+    evaluateJobs(jobHits.data, rcount);
+    const JobAggregates* a = aggregates.load(std::memory_order_acquire);
+    jobCounts.clear();
+    for (int i = 0; i < evaluated.size; ++i) {
+        JobCount* jc = jobCounts.append();
+        if (!jc) break;
+        *jc = evaluated.data[i];
+    }
+
+    // Count desc (at most one per resume), ties stay in job title order
+    CountingSort::sort(jobCounts, [](const JobCount& jc) { return jc.count; }, resumes.size(), true);
+
+    int displayed = 0;
+    for (auto k = jobCounts.begin(); jobCounts.valid(k) && displayed < MAX_JOBS_TO_DISPLAY; k = jobCounts.next(k), ++displayed) {
+        const JobCount& jc = jobCounts.at(k);
+        out.jobs.push(jc);
+        out.scoreStart.push(out.scores.size);
+
+        QueryScratch& qs = scratch[0];
+        const DynArray<int>& candidates = qs.candidates;
+        getCandidatesForJob(*jc.job, qs);
+        ScoreKernel score = scoreKernelFor(*jc.job);
+        int threshold = topScoreThreshold(a, *jc.job); // lower scores cannot reach the listing
+        scores.clear();
+        for (int ci = 0; ci < candidates.size; ++ci) {
+            int group = candidates.data[ci];
+            const ResumeGroup& g = resumeGroups.groups[group];
+            int sc = scoreCache.get(jc.job->signature, group, [&]() { return score(*jc.job, g); }, qs.cacheStats);
+            if (sc < threshold) continue;
+            for (int m = 0; m < g.size; ++m) {
+                CandidateScore* cs = scores.append();
+                if (!cs) break;
+                cs->id = resumeGroups.members[g.firstMember + m]->id;
+                cs->score = sc;
+                cs->job = jc.job;
+            }
+        }
+        // Score desc, ties by resume id. Dense ids counting sort over the id
+        // index's span; sparse ids (hashed index) would need a counter per id
+        if (resumeIds.direct) {
+            int minId = resumeIds.minId;
+            CountingSort::sort(scores, [minId](const CandidateScore& cs) { return cs.id - minId; },
+                               resumeIds.capacity - 1, false);
+        } else {
+            MergeSort::sortByKey(scores, [](const CandidateScore& cs) { return (unsigned int)cs.id; }, false);
+        }
+        CountingSort::sort(scores, [](const CandidateScore& cs) { return cs.score; }, MAX_SCORE, true);
+
+        int shown = 0;
+        for (auto c = scores.begin(); scores.valid(c) && shown < TOP_CANDIDATES; c = scores.next(c), ++shown) {
+            out.scores.push(scores.at(c));
+        }
+    }
+    out.scoreStart.push(out.scores.size);
+}
+
+template <class Storage, class Search, class Sort>
+void Engine<Storage, Search, Sort>::searchBySkill(const std::string& skillRaw) {
+    StepTimer timer;
+    timer.begin();
+
+    resultSink << "Searching for skill '" << skillRaw << "'...\n";
+
+    std::string skillNorm = normalizeKey(skillRaw);
+    std::string key = "s:" + skillNorm;
+    SearchResult* res = resultCache.find(key);
+    if (!res) {
+        res = resultCache.insert(key);
+        computeSkillSearch(skillNorm, *res);
+    }
+
+    if (res->found == 0) {
+        resultSink << "No resumes found with that skill.\n";
+    } else {
+        resultSink << "Found " << res->found << " resumes with this skill.\n";
+    }
+    resultSink << "Matching with jobs...\n";
+
+    resultSink << "\nFound " << res->total << " jobs with this skill.\n";
+    resultSink << "Sorting results...\n";
+
+    resultSink << "Top " << TOP_JOBS << " jobs related to skill '" << skillRaw << "':\n";
+    if (res->total == 0) {
+        resultSink << "No jobs found with that skill.\n\n";
+    } else {
+        for (int i = 0; i < res->jobs.size; ++i) {
+            const JobCount& jc = res->jobs.data[i];
+            resultSink << i + 1 << ". " << jc.job->titleOriginal << " | Total matched: " << jc.count;
+            if (jc.bestCandidateScore > 0) {
+                resultSink << " | Best candidate: " << jc.bestCandidateId << " | Score: " << jc.bestCandidateScore;
+            } else {
+                resultSink << " | Best candidate: None";
+            }
+            resultSink << "\n";
+        }
+        resultSink << "\n";
+    }
+
+    timer.finish(resultSink, globalStart);
+    printCacheStats();
+}
+
+// Resumes with the skill, then the jobs listing it ranked by matched candidates
+template <class Storage, class Search, class Sort>
+void Engine<Storage, Search, Sort>::computeSkillSearch(const std::string& skillNorm, SearchResult& out) {
+    int skillId = skillDict.find(skillNorm, hashString(skillNorm));
+    out.found = skillId < 0 ? 0 : resumesPerSkill[skillId];
+
+    // A job listing the skill twice appears twice in a row in its posting list
+    jobHits.clear();
+    if (skillId >= 0) {
+        for (PostingCursor pc = jobPostings.open(skillId); pc.valid(); pc.next()) {
+            const Job* job = jobByPos[pc.value];
+            if (jobHits.size == 0 || jobHits.data[jobHits.size - 1] != job) jobHits.push(job);
+        }
+    }
+
+    // Jobs are evaluated in parallel; results stay in job title order
+    evaluateJobs(jobHits.data, jobHits.size);
+    jobCounts.clear();
+    for (int i = 0; i < evaluated.size; ++i) {
+        JobCount* jc = jobCounts.append();
+        if (!jc) break;
+        *jc = evaluated.data[i];
+    }
+    out.total = jobCounts.size();
+
+    // Count desc (at most one per resume), ties stay in job title order
+    CountingSort::sort(jobCounts, [](const JobCount& jc) { return jc.count; }, resumes.size(), true);
+
+    int shown = 0;
+    for (auto c = jobCounts.begin(); jobCounts.valid(c) && shown < TOP_JOBS; c = jobCounts.next(c), ++shown) {
+        out.jobs.push(jobCounts.at(c));
+    }
+}
+
+template <class Storage, class Search, class Sort>
+void Engine<Storage, Search, Sort>::searchByCandidateID(int candId) {
+    StepTimer timer;
+    timer.begin();
+
+    std::string key = "c:" + std::to_string(candId);
+    SearchResult* res = resultCache.find(key);
+    if (!res) {
+        res = resultCache.insert(key);
+        computeCandidateSearch(candId, *res);
+    }
+
+    if (res->found == 0) {
+        resultSink << "Candidate ID " << candId << " not found.\n\n";
+        timer.finish(resultSink, globalStart);
+        printCacheStats();
+        return;
+    }
+
+    resultSink << "Top " << TOP_JOBS << " job matches for candidate " << candId << ":\n";
+    if (res->scores.size == 0) {
+        resultSink << "(no matching jobs)\n\n";
+    } else {
+        for (int i = 0; i < res->scores.size; ++i) {
+            const CandidateScore& cs = res->scores.data[i];
+            resultSink << i + 1 << ". " << cs.job->titleOriginal << " | Score: " << cs.score << "\n";
+        }
+        resultSink << "\n";
+    }
+
+    timer.finish(resultSink, globalStart);
+    printCacheStats();
+}
+
+// Jobs sharing a skill with the candidate, by score
+template <class Storage, class Search, class Sort>
+void Engine<Storage, Search, Sort>::computeCandidateSearch(int candId, SearchResult& out) {
+    const Resume* r = resumeIds.find(candId);
+    out.found = r ? 1 : 0;
+    if (!r) return;
+
+    // Accumulate matches over the postings of the candidate's distinct skill
+    // ids; jobs sharing no skill are never touched
+    touchedJobs.clear();
+    for (int s = 0; s < r->skillIdCount; ++s) {
+        for (PostingCursor pc = jobPostings.open(r->skillIds[s]); pc.valid(); pc.next()) {
+            if (jobMatches[pc.value]++ == 0) touchedJobs.push(pc.value);
+        }
+    }
+    radixSortIndices(touchedJobs.data, touchedJobs.size, [](int pos) { return (unsigned int)pos; }, false);
+
+    scores.clear();
+    for (int i = 0; i < touchedJobs.size; ++i) {
+        int pos = touchedJobs.data[i];
+        const Job& job = *jobByPos[pos];
+        int sc = PERCENT_TABLE.pct[job.skillCount][jobMatches[pos]];
+        jobMatches[pos] = 0;
+        if (sc > 0) {
+            CandidateScore* cs = scores.append();
+            if (!cs) continue;
+            cs->id = 0;
+            cs->score = sc;
+            cs->job = &job;
+        }
+    }
+    // Score desc, ties stay in job title order
+    CountingSort::sort(scores, [](const CandidateScore& cs) { return cs.score; }, MAX_SCORE, true);
+
+    int shown = 0;
+    for (auto c = scores.begin(); scores.valid(c) && shown < TOP_JOBS; c = scores.next(c), ++shown) {
+        out.scores.push(scores.at(c));
+    }
+}
+
+// ------------------- CLEANUP -------------------
+template <class Storage, class Search, class Sort>
+void Engine<Storage, Search, Sort>::cleanup() {
+    // The warm-up reads everything below
+    stopWarmUp.store(true);
+    if (warmer.joinable()) warmer.join();
+    JobAggregates* a = aggregates.exchange(nullptr);
+    if (a) {
+        a->destroy();
+        delete a;
+    }
+    for (auto c = jobs.begin(); jobs.valid(c); c = jobs.next(c)) {
+        delete[] jobs.at(c).skills;
+    }
+    for (auto c = resumes.begin(); resumes.valid(c); c = resumes.next(c)) {
+        Resume& r = resumes.at(c);
+        delete[] r.skills;
+    }
+    jobs.destroy();
+    resumes.destroy();
+    resumeIds.destroy();
+    scores.destroy();
+    jobCounts.destroy();
+    titleBases.destroy();
+    skillDict.destroy();
+    jobSkillPool.destroy();
+    resumeSkillPool.destroy();
+    resumeGroups.destroy();
+    resumeSets.destroy();
+    scoreCache.destroy();
+    resultCache.destroy();
+    delete[] resumesPerSkill;
+    jobPostings.destroy();
+    titleGrams.destroy();
+    titleHits.destroy();
+    delete[] jobByPos;
+    delete[] jobMatches;
+    touchedJobs.destroy();
+    if (scratch) {
+        for (int w = 0; w < pool.size(); ++w) destroyScratch(scratch[w]);
+        delete[] scratch;
+        scratch = nullptr;
+    }
+    jobHits.destroy();
+    evaluated.destroy();
+    pool.destroy();
+    resultSink.destroy();
+}
+
+// Cumulative since the menu opened; score lookups made by searches, over every
+// thread (precomputed aggregates are not counted)
+template <class Storage, class Search, class Sort>
+void Engine<Storage, Search, Sort>::printCacheStats() {
+    long long searches = resultCache.hits + resultCache.misses;
+    std::cout << "Result cache: " << resultCache.hits << " hits, " << resultCache.misses << " misses ("
+              << (searches > 0 ? 100.0 * resultCache.hits / searches : 0.0) << "% hit rate)\n";
+
+    long long hits = 0, misses = 0;
+    for (int w = 0; w < pool.size(); ++w) {
+        hits += scratch[w].cacheStats.hits;
+        misses += scratch[w].cacheStats.misses;
+    }
+    long long lookups = hits + misses;
+    std::cout << "Score cache: " << hits << " hits, " << misses << " misses ("
+              << (lookups > 0 ? 100.0 * hits / lookups : 0.0) << "% hit rate)\n\n";
+}
+
+// Best-matched titles starting with the prefix, from the trie's cached lists.
+// Before the trie is published the matching jobs are scanned and counted here,
+// ranked the same way (count desc, then title order, one job per title).
+template <class Storage, class Search, class Sort>
+void Engine<Storage, Search, Sort>::suggestJobTitles(const std::string& prefixRaw) {
+    StepTimer timer;
+    timer.begin();
+
+    std::string pNorm = normalizeKey(prefixRaw);
+    int matching = 0;
+    int top[TRIE_TOP];
+    int topCandidates[TRIE_TOP];
+    int topCount = 0;
+    const JobAggregates* a = aggregates.load(std::memory_order_acquire);
+    if (a) {
+        int at = a->titleTrie.findPrefix(pNorm, [this](int pos) -> const std::string& { return titleAt(pos); });
+        if (at >= 0) {
+            const TitleTrie::Node& node = a->titleTrie.nodes.data[at];
+            matching = node.hi - node.lo;
+            for (int k = 0; k < node.topCount; ++k) {
+                top[topCount] = node.top[k];
+                topCandidates[topCount++] = a->jobCandidates[node.top[k]];
+            }
+        }
+    } else {
+        titleHits.clear();
+        for (int p = 0; p < jobs.size(); ++p) {
+            if (titleAt(p).compare(0, pNorm.size(), pNorm) == 0) titleHits.push(p);
+        }
+        matching = titleHits.size;
+        int* counts = new int[matching > 0 ? matching : 1];
+        int* order = new int[matching > 0 ? matching : 1];
+        pool.parallelFor(0, matching, JOB_GRAIN, [&](int lo, int hi, int worker) {
+            QueryScratch& qs = scratch[worker];
+            for (int i = lo; i < hi; ++i) {
+                getCandidatesForJob(*jobByPos[titleHits.data[i]], qs);
+                int total = 0;
+                for (int c = 0; c < qs.candidates.size; ++c) total += resumeGroups.groups[qs.candidates.data[c]].size;
+                counts[i] = total;
+            }
+        });
+        for (int i = 0; i < matching; ++i) order[i] = i;
+        // Hits are in title order, so the stable sort keeps it among equal counts
+        mergeSortIndices(order, matching, [&](int x, int y) { return counts[x] > counts[y]; });
+        for (int i = 0; i < matching && topCount < TRIE_TOP; ++i) {
+            int pos = titleHits.data[order[i]];
+            bool repeated = false;
+            for (int k = 0; k < topCount && !repeated; ++k) repeated = titleAt(top[k]) == titleAt(pos);
+            if (repeated) continue;
+            top[topCount] = pos;
+            topCandidates[topCount++] = counts[order[i]];
+        }
+        delete[] order;
+        delete[] counts;
+    }
+
+    if (matching == 0) {
+        resultSink << "No job titles start with '" << prefixRaw << "'.\n\n";
+        timer.finish(resultSink, globalStart);
+        return;
+    }
+
+    resultSink << matching << " jobs start with '" << prefixRaw << "'. Suggestions:\n";
+    for (int k = 0; k < topCount; ++k) {
+        resultSink << (k + 1) << ". " << jobByPos[top[k]]->titleOriginal
+                   << " | Matched candidates: " << topCandidates[k] << "\n";
+    }
+    resultSink << "\n";
+
+    timer.finish(resultSink, globalStart);
+}
+
+// ------------------- MAIN FLOW -------------------
+template <class Storage, class Search, class Sort>
+int Engine<Storage, Search, Sort>::run(int argc, char* argv[]) {
+    if (!parseEngineArgs(argc, argv, resultSink, options)) return 1;
+    std::ios::sync_with_stdio(false);
+    std::cin.tie(nullptr);
+
+    pool.init(options.threads);
+    globalStart = std::chrono::high_resolution_clock::now();
+    StepTimer timer;
+
+    jobs.init(MAX_JOBS);
+    resumes.init(MAX_RESUMES);
+    scores.init(MAX_JOBS > MAX_RESUMES ? MAX_JOBS : MAX_RESUMES);
+    jobCounts.init(MAX_JOBS);
+    jobHits.init();
+    evaluated.init(256);
+    touchedJobs.init(256);
+    titleHits.init(256);
+    jobByPos = nullptr;
+    resumesPerSkill = nullptr;
+    resumeGroups.init();
+    scoreCache.init();
+    resultCache.init(RESULT_CACHE_ENTRIES);
+    resumeSets.init();
+    jobPostings.init();
+    aggregates.store(nullptr);
+    stopWarmUp.store(false);
+    jobMatches = nullptr;
+    titleBases.init();
+    skillDict.init();
+    jobSkillPool.init(4096);
+    resumeSkillPool.init(4096);
+    resumeIds.init();
+    scratch = nullptr;
+    unionWords = 0;
+
+    std::cout << "[1/6] Loading jobs from job_grouped.csv...\n";
+    timer.begin();
+    int jobCount = loadJobs("job_grouped.csv");
+    std::cout << "Loaded " << jobCount << " jobs.\n";
+    timer.finish(resultSink, globalStart);
+
+    std::cout << "[2/6] Loading resumes from resume_cleaned.csv...\n";
+    timer.begin();
+    int resumeCount = loadResumes("resume_cleaned.csv");
+    std::cout << "Loaded " << resumeCount << " resumes.\n";
+    timer.finish(resultSink, globalStart);
+
+    std::cout << "[3/6] Sorting jobs (title asc) using " << Sort::name() << "...\n";
+    timer.begin();
+    int slices = ParallelSort<Sort>::sortByKey(jobs, [](const Job& j) { return j.titleKey; }, false, pool);
+    if (slices > 1) std::cout << "Sorted " << slices << " slices on the thread pool, then merged them.\n";
+    std::cout << "Sorted jobs. Displaying first " << FIRST_N_DISPLAY << ":\n";
+    printFirstNJobs(FIRST_N_DISPLAY);
+    timer.finish(resultSink, globalStart);
+
+    std::cout << "[4/6] Sorting resumes (skill count desc) using counting sort...\n";
+    timer.begin();
+    // Resumes are still in file (id) order, so ties stay in id order
+    CountingSort::sort(resumes, [](const Resume& r) { return r.skillCount; }, MAX_SKILLS, true);
+    std::cout << "Sorted resumes. Displaying first " << FIRST_N_DISPLAY << ":\n";
+    printFirstNResumes(FIRST_N_DISPLAY);
+    timer.finish(resultSink, globalStart);
+
+    std::cout << "[5/6] Building skill index. Matching occurs at search time.\n";
+    timer.begin();
+    buildIndex();
+    if (options.background) {
+        startWarmUp();
+        std::cout << "Building title suggestions" << (options.precompute ? " and match statistics" : "")
+                  << " in the background.\n";
+    } else {
+        JobAggregates* a = buildAggregates(true);
+        reportAggregates(*a);
+        aggregates.store(a, std::memory_order_release);
+        // Precompute lookups are not counted, as they are not with --background
+        for (int w = 0; w < pool.size(); ++w) scratch[w].cacheStats = ScoreCacheStats{0, 0};
+    }
+    timer.finish(resultSink, globalStart);
+
+    std::cout << "[6/6] Entering interactive menu.\n\n";
+
+    const std::string banner = menuBanner();
+    bool warmUpReported = !options.background;
+    while (true) {
+        const JobAggregates* ready = warmUpReported ? nullptr : aggregates.load(std::memory_order_acquire);
+        if (ready) {
+            std::cout << "Background warm-up finished at " << ready->readyMs << " ms.\n";
+            reportAggregates(*ready);
+            std::cout << "\n";
+            warmUpReported = true;
+        }
+        std::cout << "================== MENU ==================\n";
+        std::cout << banner << "\n";
+        std::cout << "1. Search by Job Title\n2. Search by Skill\n3. Search by Candidate ID\n4. Exit\n5. Autocomplete Job Title\nEnter choice: ";
+        std::cout << std::flush;
+
+        int choice;
+        if (!(std::cin >> choice)) {
+            if (std::cin.eof()) break;
+            std::cin.clear();
+            std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+            std::cout << "Invalid input. Please enter a number.\n\n";
+            continue;
+        }
+        std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+
+        if (choice == 1) {
+            std::cout << "Enter job title or keyword: " << std::flush;
+            std::string q;
+            std::getline(std::cin, q);
+            if (trim(q).empty()) {
+                std::cout << "Empty input. Please type a job title or keyword.\n\n";
+                continue;
+            }
+            searchByJobTitle(q);
+        } else if (choice == 2) {
+            std::cout << "Enter skill: " << std::flush;
+            std::string sk;
+            std::getline(std::cin, sk);
+            if (trim(sk).empty()) {
+                std::cout << "Empty input. Please type a skill.\n\n";
+                continue;
+            }
+            searchBySkill(sk);
+        } else if (choice == 3) {
+            std::cout << "Enter candidate ID (integer): " << std::flush;
+            int cid;
+            if (!(std::cin >> cid)) {
+                std::cin.clear();
+                std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+                std::cout << "Invalid candidate id.\n\n";
+                continue;
+            }
+            std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+            searchByCandidateID(cid);
+        } else if (choice == 4) {
+            std::cout << "Exiting program.\n";
+            break;
+        } else if (choice == 5) {
+            std::cout << "Enter the start of a job title: " << std::flush;
+            std::string p;
+            std::getline(std::cin, p);
+            if (trim(p).empty()) {
+                std::cout << "Empty input. Please type the start of a job title.\n\n";
+                continue;
+            }
+            suggestJobTitles(p);
+        } else {
+            std::cout << "Invalid option.\n\n";
+        }
+    }
+
+    std::cout << "Cleaning up memory...\n";
+    cleanup();
+    return 0;
+}
+
+#endif
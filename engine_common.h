@@ -0,0 +1,863 @@
+// engine_common.h
+// Shared pieces of the job matching engine: config, entity structs, string and
+// CSV helpers, memory tracking and the manual containers used by the index.
+//
+#ifndef ENGINE_COMMON_H
+#define ENGINE_COMMON_H
+
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <chrono>
+#include <cctype>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#if defined(_WIN32)
+    #ifndef NOMINMAX
+    #define NOMINMAX
+    #endif
+    #include <windows.h>
+    #include <psapi.h>
+    #pragma comment(lib, "psapi.lib")  // Auto-link for MSVC
+#elif defined(__APPLE__) && defined(__MACH__)
+    #include <mach/mach.h>
+    #include <sys/resource.h>
+#elif defined(__linux__)
+    #include <unistd.h>
+    #include <sys/resource.h>
+#endif
+
+#include "output_sink.h"
+
+// ------------------- CONFIG -------------------
+const int MAX_JOBS = 7000;     // capacity of the array storage
+const int MAX_RESUMES = 11000; // capacity of the array storage
+const int MAX_SKILLS = 200;    // skills kept per job / resume
+const int MAX_SCORE = 100;     // scores are percentages
+
+// PERFORMANCE LIMITS - adjust these if queries are too slow
+const int MAX_JOBS_TO_ANALYZE = 100; // Limit jobs processed per title query
+const int MAX_JOBS_TO_DISPLAY = 5;   // Show top 5 jobs only
+const int TOP_CANDIDATES = 50;       // Candidates listed per job
+const int TOP_JOBS = 1000;           // Jobs listed per skill / candidate query
+const int FIRST_N_DISPLAY = 1000;    // Rows shown after each startup sort
+const int RESULT_CACHE_ENTRIES = 64; // Recent searches whose results are kept
+
+// Hash table config for HashSet
+const int HASH_SET_BUCKETS = 503; // Prime; the set holds only the distinct base titles
+
+// ------------------- MANUAL DYNAMIC ARRAY -------------------
+template <class T>
+struct DynArray {
+    T* data;
+    int size;
+    int capacity;
+
+    void init(int cap = 16) {
+        capacity = cap > 0 ? cap : 1;
+        size = 0;
+        data = new T[capacity];
+    }
+
+    void push(const T& value) {
+        if (size >= capacity) {
+            int newCap = capacity * 2;
+            T* newData = new T[newCap];
+            for (int i = 0; i < size; ++i) {
+                newData[i] = data[i];
+            }
+            delete[] data;
+            data = newData;
+            capacity = newCap;
+        }
+        data[size++] = value;
+    }
+
+    void clear() {
+        size = 0;
+    }
+
+    void destroy() {
+        if (data) {
+            delete[] data;
+            data = nullptr;
+        }
+        size = 0;
+        capacity = 0;
+    }
+};
+
+inline unsigned int hashString(const std::string& s) {
+    unsigned int h = 0;
+    for (char c : s) {
+        h = h * 31 + (unsigned char)c;
+    }
+    return h;
+}
+
+// ------------------- MANUAL HASH SET (for the title dictionary) -------------------
+struct HashSetNode {
+    std::string key;
+    HashSetNode* next;
+};
+
+struct HashSet {
+    HashSetNode* buckets[HASH_SET_BUCKETS];
+
+    void init() {
+        for (int i = 0; i < HASH_SET_BUCKETS; ++i) {
+            buckets[i] = nullptr;
+        }
+    }
+
+    void insert(const std::string& key) {
+        unsigned int idx = hashString(key) % HASH_SET_BUCKETS;
+
+        // Check if already exists
+        HashSetNode* curr = buckets[idx];
+        while (curr) {
+            if (curr->key == key) return;
+            curr = curr->next;
+        }
+
+        HashSetNode* newNode = new HashSetNode;
+        newNode->key = key;
+        newNode->next = buckets[idx];
+        buckets[idx] = newNode;
+    }
+
+    bool contains(const std::string& key) const {
+        unsigned int idx = hashString(key) % HASH_SET_BUCKETS;
+        HashSetNode* curr = buckets[idx];
+        while (curr) {
+            if (curr->key == key) return true;
+            curr = curr->next;
+        }
+        return false;
+    }
+
+    void destroy() {
+        for (int i = 0; i < HASH_SET_BUCKETS; ++i) {
+            HashSetNode* curr = buckets[i];
+            while (curr) {
+                HashSetNode* tmp = curr;
+                curr = curr->next;
+                delete tmp;
+            }
+            buckets[i] = nullptr;
+        }
+    }
+};
+
+// ------------------- STRUCTS -------------------
+struct Skill {
+    std::string original;
+    std::string norm;
+    unsigned int hash; // hashString(norm)
+};
+
+struct Job {
+    std::string titleOriginal;
+    std::string titleNorm;       // normalizeKey(titleOriginal), for substring search
+    unsigned long long titleKey; // see TITLE KEYS
+    std::string skillsOriginal;
+    Skill* skills;
+    int skillCount;
+    const int* skillIds; // sorted SkillDictionary ids of the non-empty skills, repeats kept
+    int skillIdCount;
+    int pos;       // position in title order, set when the index is built
+    int signature; // same skillIds and skillCount -> same number, for the score cache
+};
+
+struct Resume {
+    int id;
+    std::string skillsOriginal;
+    Skill* skills;
+    int skillCount;
+    const int* skillIds; // sorted distinct SkillDictionary ids, built by the loader
+    int skillIdCount;
+};
+
+struct CandidateScore {
+    int id;          // resume id (0 for job matches)
+    int score;
+    const Job* job;  // job for candidate -> job matches
+};
+
+struct JobCount {
+    const Job* job;
+    int count;
+    int bestCandidateId;
+    int bestCandidateScore;
+};
+
+// ------------------- RESUME ID INDEX -------------------
+// id -> resume in O(1). Dense ids (the loader numbers resumes 1..n) use a
+// direct-address array over [minId, maxId]; ids spread wider than
+// ID_DIRECT_SPREAD slots per resume fall back to an open-addressing hash.
+const int ID_DIRECT_SPREAD = 4;
+
+struct ResumeIdIndex {
+    const Resume** slots; // direct: slots[id - minId]; hashed: probed by id
+    int* keys;            // hashed mode only, 0 = empty (ids are positive)
+    int minId;
+    int capacity;
+    bool direct;
+
+    void init() {
+        slots = nullptr;
+        keys = nullptr;
+        minId = 0;
+        capacity = 0;
+        direct = true;
+    }
+
+    void build(const Resume* const* list, int n) {
+        destroy();
+        if (n == 0) return;
+        int lo = list[0]->id, hi = list[0]->id;
+        for (int i = 1; i < n; ++i) {
+            if (list[i]->id < lo) lo = list[i]->id;
+            if (list[i]->id > hi) hi = list[i]->id;
+        }
+        long long span = (long long)hi - lo + 1;
+        direct = span <= (long long)ID_DIRECT_SPREAD * n;
+        if (direct) {
+            minId = lo;
+            capacity = (int)span;
+            slots = new const Resume*[capacity];
+            for (int i = 0; i < capacity; ++i) slots[i] = nullptr;
+            for (int i = 0; i < n; ++i) slots[list[i]->id - minId] = list[i];
+            return;
+        }
+        capacity = 16;
+        while (capacity < 2 * n) capacity *= 2;
+        slots = new const Resume*[capacity];
+        keys = new int[capacity];
+        for (int i = 0; i < capacity; ++i) keys[i] = 0;
+        for (int i = 0; i < n; ++i) {
+            int at = probe(list[i]->id);
+            keys[at] = list[i]->id;
+            slots[at] = list[i];
+        }
+    }
+
+    const Resume* find(int id) const {
+        if (direct) {
+            long long at = (long long)id - minId;
+            return (at >= 0 && at < capacity) ? slots[at] : nullptr;
+        }
+        if (id <= 0) return nullptr;
+        int at = probe(id);
+        return keys[at] == id ? slots[at] : nullptr;
+    }
+
+    void destroy() {
+        delete[] slots;
+        delete[] keys;
+        init();
+    }
+
+private:
+    // Slot holding id, or the empty slot where it would go
+    int probe(int id) const {
+        unsigned int at = ((unsigned int)id * 2654435761u) & (unsigned int)(capacity - 1);
+        while (keys[at] != 0 && keys[at] != id) at = (at + 1) & (unsigned int)(capacity - 1);
+        return (int)at;
+    }
+};
+
+// ------------------- UTILITIES -------------------
+inline std::string toLowerCopy(const std::string &s) {
+    std::string out;
+    out.reserve(s.size());
+    for (char c : s) out.push_back((char)tolower((unsigned char)c));
+    return out;
+}
+
+inline std::string removeSpaces(const std::string &s) {
+    std::string out;
+    out.reserve(s.size());
+    for (char c : s) if (!isspace((unsigned char)c)) out.push_back(c);
+    return out;
+}
+
+inline std::string normalizeKey(const std::string &s) {
+    return removeSpaces(toLowerCopy(s));
+}
+
+inline std::string trim(const std::string &s) {
+    size_t a = s.find_first_not_of(" \t\r\n");
+    if (a == std::string::npos) return "";
+    size_t b = s.find_last_not_of(" \t\r\n");
+    return s.substr(a, b - a + 1);
+}
+
+// Lower case, whitespace runs as one space, trimmed. Title searches depend on
+// both splitTitle() and normalizeKey() of the query, and both depend only on
+// this, so it keys cached title results.
+inline std::string titleQueryKey(const std::string &s) {
+    std::string t = trim(s);
+    std::string out;
+    out.reserve(t.size());
+    bool prevSpace = false;
+    for (char c : t) {
+        if (isspace((unsigned char)c)) {
+            if (!prevSpace) out.push_back(' ');
+            prevSpace = true;
+        } else {
+            out.push_back((char)tolower((unsigned char)c));
+            prevSpace = false;
+        }
+    }
+    return out;
+}
+
+// ------------------- TITLE KEYS -------------------
+// Titles sort by base title (case and spacing ignored), then un-numbered before
+// numbered, then by group number: "Data Analyst" < "Data Analyst 2" < "Data Analyst 12".
+// Each job gets a 64-bit key: [ base rank | has number | group number ], so
+// sorting and exact search compare integers instead of strings.
+const int TITLE_NUMBER_BITS = 34; // fits every 10-digit group number
+const unsigned long long TITLE_NUMBER_MAX = (1ULL << TITLE_NUMBER_BITS) - 1;
+
+// "Data  Analyst 12" -> base "data analyst", hasNumber true, number 12.
+// A number above TITLE_NUMBER_MAX stays in the base instead, so distinct long
+// numbers never share a key.
+inline void splitTitle(const std::string &title, std::string &base, bool &hasNumber, unsigned long long &number) {
+    std::string t = trim(title);
+    int i = (int)t.size() - 1;
+    while (i >= 0 && isdigit((unsigned char)t[i])) --i;
+    int startDigits = i + 1;
+
+    number = 0;
+    for (int k = startDigits; k < (int)t.size(); ++k) {
+        number = number * 10 + (unsigned long long)(t[k] - '0');
+        if (number > TITLE_NUMBER_MAX) {
+            startDigits = (int)t.size();
+            number = 0;
+            break;
+        }
+    }
+    hasNumber = startDigits < (int)t.size();
+
+    // lower case and collapse runs of whitespace
+    base.clear();
+    bool prevSpace = false;
+    for (int k = 0; k < startDigits; ++k) {
+        char c = t[k];
+        if (isspace((unsigned char)c)) {
+            if (!prevSpace) { base.push_back(' '); prevSpace = true; }
+        } else {
+            base.push_back((char)tolower((unsigned char)c));
+            prevSpace = false;
+        }
+    }
+    base = trim(base);
+}
+
+// Orders base titles as if each ended in '|', so "data analyst" sorts after
+// "data analyst intern" exactly as the old "base|number" string keys did
+inline bool titleBaseLess(const std::string &a, const std::string &b) {
+    size_t n = a.size() > b.size() ? a.size() : b.size();
+    for (size_t i = 0; i <= n; ++i) {
+        unsigned char ca = i < a.size() ? (unsigned char)a[i] : (unsigned char)'|';
+        unsigned char cb = i < b.size() ? (unsigned char)b[i] : (unsigned char)'|';
+        if (ca != cb) return ca < cb;
+        if (i >= a.size() || i >= b.size()) break;
+    }
+    return false;
+}
+
+inline unsigned long long packTitleKey(int rank, bool hasNumber, unsigned long long number) {
+    return ((unsigned long long)rank << (TITLE_NUMBER_BITS + 1)) |
+           ((hasNumber ? 1ULL : 0ULL) << TITLE_NUMBER_BITS) | number;
+}
+
+// Interned base titles, ranked alphabetically. add() every base, then finalize().
+struct TitleDictionary {
+    DynArray<std::string> bases;
+    HashSet added;
+
+    void init() {
+        bases.init();
+        added.init();
+    }
+
+    void add(const std::string &base) {
+        if (added.contains(base)) return;
+        added.insert(base);
+        bases.push(base);
+    }
+
+    // Insertion sort: there are only a handful of distinct base titles
+    void finalize() {
+        for (int i = 1; i < bases.size; ++i) {
+            std::string key = bases.data[i];
+            int j = i - 1;
+            while (j >= 0 && titleBaseLess(key, bases.data[j])) {
+                bases.data[j + 1] = bases.data[j];
+                --j;
+            }
+            bases.data[j + 1] = key;
+        }
+        added.destroy();
+    }
+
+    // Rank of a base title, or -1 if no job has it
+    int rank(const std::string &base) const {
+        int left = 0, right = bases.size - 1;
+        while (left <= right) {
+            int mid = left + (right - left) / 2;
+            if (bases.data[mid] == base) return mid;
+            if (titleBaseLess(bases.data[mid], base)) left = mid + 1;
+            else right = mid - 1;
+        }
+        return -1;
+    }
+
+    void destroy() {
+        bases.destroy();
+        added.destroy();
+    }
+};
+
+// ------------------- MEMORY TRACKING -------------------
+inline double getMemoryUsageKB() {
+#if defined(_WIN32)
+    PROCESS_MEMORY_COUNTERS_EX pmc;
+    if (GetProcessMemoryInfo(GetCurrentProcess(), (PROCESS_MEMORY_COUNTERS*)&pmc, sizeof(pmc))) {
+        return (double)pmc.WorkingSetSize / 1024.0;
+    }
+    return 0.0;
+
+#elif defined(__APPLE__) && defined(__MACH__)
+    struct mach_task_basic_info info;
+    mach_msg_type_number_t count = MACH_TASK_BASIC_INFO_COUNT;
+    if (task_info(mach_task_self(), MACH_TASK_BASIC_INFO, (task_info_t)&info, &count) == KERN_SUCCESS)
+        return info.resident_size / 1024.0;
+
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) == 0)
+        return usage.ru_maxrss / 1024.0;
+    return 0.0;
+
+#elif defined(__linux__)
+    FILE* file = fopen("/proc/self/status", "r");
+    if (file) {
+        char line[128];
+        while (fgets(line, sizeof(line), file)) {
+            if (strncmp(line, "VmRSS:", 6) == 0) {
+                long rss = 0;
+                sscanf(line + 6, "%ld", &rss);
+                fclose(file);
+                return (double)rss;
+            }
+        }
+        fclose(file);
+    }
+
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) == 0)
+        return (double)usage.ru_maxrss;
+    return 0.0;
+
+#else
+    return 0.0; // fallback for unknown systems
+#endif
+}
+
+inline void printStepStatsSimple(OutputSink& resultSink, long long stepMs, long long cumMs,
+                                 double stepMemKB, double totalMemKB) {
+    resultSink.endStep(); // results of this step are written before its stats
+    std::cout << "Step Time: " << stepMs << " ms | Cumulative Time: " << cumMs << " ms\n";
+    long long stepMemBytes = (long long)(stepMemKB * 1024);
+    long long totalMemBytes = (long long)(totalMemKB * 1024);
+
+    // Handle potential negative or very small memory changes on Windows
+    if (stepMemBytes < 0) {
+        std::cout << "Step Memory Change: " << stepMemBytes << " bytes (freed)";
+    } else {
+        std::cout << "Step Memory Change: " << stepMemBytes << " bytes";
+    }
+    std::cout << " | Current Total Memory: " << totalMemBytes << " bytes\n";
+}
+
+// Times one step: begin() at the start, finish() prints the step stats.
+struct StepTimer {
+    std::chrono::high_resolution_clock::time_point start;
+    double memStart;
+
+    void begin() {
+        start = std::chrono::high_resolution_clock::now();
+        memStart = getMemoryUsageKB();
+    }
+
+    void finish(OutputSink& resultSink, const std::chrono::high_resolution_clock::time_point& globalStart) {
+        using namespace std::chrono;
+        auto end = high_resolution_clock::now();
+        double memEnd = getMemoryUsageKB();
+        printStepStatsSimple(resultSink,
+                             duration_cast<milliseconds>(end - start).count(),
+                             duration_cast<milliseconds>(end - globalStart).count(),
+                             memEnd - memStart, memEnd);
+        std::cout << "\n";
+    }
+};
+
+// ------------------- CSV FIELD EXTRACTION -------------------
+inline bool extractQuotedField(const std::string &line, size_t &pos, std::string &outField) {
+    outField.clear();
+    size_t n = line.size();
+    while (pos < n && isspace((unsigned char)line[pos])) pos++;
+    if (pos >= n) return false;
+
+    if (line[pos] != '"') {
+        size_t comma = line.find(',', pos);
+        if (comma == std::string::npos) {
+            outField = trim(line.substr(pos));
+            pos = n;
+        } else {
+            outField = trim(line.substr(pos, comma - pos));
+            pos = comma + 1;
+        }
+        return true;
+    }
+
+    pos++;
+    while (pos < n) {
+        if (line[pos] == '"') {
+            if (pos + 1 < n && line[pos + 1] == '"') {
+                outField.push_back('"');
+                pos += 2;
+            } else {
+                pos++;
+                if (pos < n && line[pos] == ',') pos++;
+                break;
+            }
+        } else {
+            outField.push_back(line[pos++]);
+        }
+    }
+    return true;
+}
+
+// ------------------- SKILL PARSING -------------------
+// Splits "SQL, Excel, Power BI" into a new[]-allocated Skill array (nullptr if empty).
+// Safe to call from several loader threads at once.
+inline int buildSkillArray(const std::string &skillsLine, Skill*& out) {
+    static thread_local Skill tmp[MAX_SKILLS];
+    int count = 0;
+    std::string token;
+    size_t i = 0, n = skillsLine.size();
+    while (i <= n) {
+        if (i == n || skillsLine[i] == ',') {
+            std::string t = trim(token);
+            if (!t.empty() && count < MAX_SKILLS) {
+                tmp[count].original = t;
+                tmp[count].norm = normalizeKey(t);
+                tmp[count].hash = hashString(tmp[count].norm);
+                ++count;
+            }
+            token.clear();
+            ++i;
+        } else {
+            token.push_back(skillsLine[i++]);
+        }
+    }
+    if (count == 0) {
+        // Nothing between the commas: treat the whole line as one skill
+        std::string t = trim(skillsLine);
+        if (!t.empty()) {
+            tmp[count].original = t;
+            tmp[count].norm = normalizeKey(t);
+            tmp[count].hash = hashString(tmp[count].norm);
+            ++count;
+        }
+    }
+    out = nullptr;
+    if (count > 0) {
+        out = new Skill[count];
+        for (int k = 0; k < count; ++k) out[k] = tmp[k];
+    }
+    return count;
+}
+
+// ------------------- SKILL IDS -------------------
+// Every distinct normalized skill gets a small int id. Jobs and resumes keep
+// their skills as sorted id runs in shared pools, so a match count is a merge
+// of two short int arrays (score_kernels.h) rather than string lookups.
+struct SkillDictionary {
+    struct Slot {
+        unsigned int hash;
+        int id;   // -1 = empty
+    };
+
+    Slot* slots;   // open addressing, power-of-two capacity
+    int capacity;
+    DynArray<std::string> names; // names.data[id]
+
+    void init() {
+        capacity = 1024;
+        slots = new Slot[capacity];
+        for (int i = 0; i < capacity; ++i) slots[i].id = -1;
+        names.init(256);
+    }
+
+    // Id of the skill, or -1 if it was never interned
+    int find(const std::string& norm, unsigned int h) const {
+        int at = probe(norm, h);
+        return slots[at].id;
+    }
+
+    int intern(const std::string& norm, unsigned int h) {
+        int at = probe(norm, h);
+        if (slots[at].id >= 0) return slots[at].id;
+        if ((names.size + 1) * 2 > capacity) {
+            grow();
+            at = probe(norm, h);
+        }
+        slots[at].hash = h;
+        slots[at].id = names.size;
+        names.push(norm);
+        return slots[at].id;
+    }
+
+    int size() const { return names.size; }
+
+    void destroy() {
+        delete[] slots;
+        slots = nullptr;
+        names.destroy();
+    }
+
+private:
+    int probe(const std::string& norm, unsigned int h) const {
+        int at = (int)((h * 2654435761u) & (unsigned int)(capacity - 1));
+        while (slots[at].id >= 0 && !(slots[at].hash == h && names.data[slots[at].id] == norm)) {
+            at = (at + 1) & (capacity - 1);
+        }
+        return at;
+    }
+
+    void grow() {
+        Slot* old = slots;
+        int oldCapacity = capacity;
+        capacity *= 2;
+        slots = new Slot[capacity];
+        for (int i = 0; i < capacity; ++i) slots[i].id = -1;
+        for (int i = 0; i < oldCapacity; ++i) {
+            if (old[i].id < 0) continue;
+            int at = (int)((old[i].hash * 2654435761u) & (unsigned int)(capacity - 1));
+            while (slots[at].id >= 0) at = (at + 1) & (capacity - 1);
+            slots[at] = old[i];
+        }
+        delete[] old;
+    }
+};
+
+// Appends the ids of the non-empty skills to 'pool' in ascending order and
+// returns how many were appended; 'distinct' drops repeated ids
+inline int appendSkillIds(SkillDictionary& dict, const Skill* skills, int n, bool distinct, DynArray<int>& pool) {
+    int start = pool.size;
+    for (int s = 0; s < n; ++s) {
+        if (skills[s].norm.empty()) continue;
+        int v = dict.intern(skills[s].norm, skills[s].hash);
+        int j = pool.size - 1;
+        bool repeated = false;
+        while (j >= start && pool.data[j] >= v) {
+            if (pool.data[j] == v) repeated = true;
+            --j;
+        }
+        if (distinct && repeated) continue;
+        pool.push(v);
+        for (int k = pool.size - 1; k > j + 1; --k) pool.data[k] = pool.data[k - 1];
+        pool.data[j + 1] = v;
+    }
+    return pool.size - start;
+}
+
+// ------------------- RESUME GROUPS -------------------
+// Resumes with the same skill set (same sorted distinct ids) score the same
+// against every job, so they are indexed and scored once per group and the
+// score is fanned out to the members.
+struct ResumeGroup {
+    const int* skillIds;   // the members' shared sorted distinct ids
+    int skillIdCount;
+    int size;              // member count
+    int minId;             // lowest member id, for score ties
+    int firstMember;       // members are ResumeGroups::members[firstMember, firstMember + size)
+};
+
+inline unsigned int hashSkillIds(const int* ids, int n) {
+    unsigned int h = 2166136261u; // FNV-1a over the ids
+    for (int i = 0; i < n; ++i) h = (h ^ (unsigned int)ids[i]) * 16777619u;
+    return h;
+}
+
+// Interns runs of skill ids (plus a tag) as dense signature numbers. The runs
+// are referenced, not copied, so they must outlive the table.
+struct SignatureTable {
+    struct Slot {
+        unsigned int hash;
+        int sig;          // -1 = empty
+    };
+    struct Key {
+        const int* ids;
+        int n;
+        int tag;
+    };
+
+    Slot* slots;
+    int capacity;
+    DynArray<Key> keys;   // keys.data[sig]
+
+    void init(int expected) {
+        capacity = 16;
+        while (capacity < 2 * expected) capacity *= 2;
+        slots = new Slot[capacity];
+        for (int i = 0; i < capacity; ++i) slots[i].sig = -1;
+        keys.init(64);
+    }
+
+    int intern(const int* ids, int n, int tag) {
+        unsigned int h = hashSkillIds(ids, n) ^ ((unsigned int)tag * 2654435761u);
+        unsigned int at = h & (unsigned int)(capacity - 1);
+        while (slots[at].sig >= 0) {
+            const Key& k = keys.data[slots[at].sig];
+            if (slots[at].hash == h && k.n == n && k.tag == tag && memcmp(k.ids, ids, sizeof(int) * n) == 0) {
+                return slots[at].sig;
+            }
+            at = (at + 1) & (unsigned int)(capacity - 1);
+        }
+        if ((keys.size + 1) * 2 > capacity) {
+            grow();
+            return intern(ids, n, tag);
+        }
+        slots[at].hash = h;
+        slots[at].sig = keys.size;
+        keys.push(Key{ids, n, tag});
+        return slots[at].sig;
+    }
+
+    int size() const { return keys.size; }
+
+    void destroy() {
+        delete[] slots;
+        slots = nullptr;
+        keys.destroy();
+    }
+
+private:
+    void grow() {
+        Slot* old = slots;
+        int oldCapacity = capacity;
+        capacity *= 2;
+        slots = new Slot[capacity];
+        for (int i = 0; i < capacity; ++i) slots[i].sig = -1;
+        for (int i = 0; i < oldCapacity; ++i) {
+            if (old[i].sig < 0) continue;
+            unsigned int at = old[i].hash & (unsigned int)(capacity - 1);
+            while (slots[at].sig >= 0) at = (at + 1) & (unsigned int)(capacity - 1);
+            slots[at] = old[i];
+        }
+        delete[] old;
+    }
+};
+
+struct ResumeGroups {
+    ResumeGroup* groups;
+    int count;
+    const Resume** members; // grouped; inside a group, in the order given to build()
+
+    void init() {
+        groups = nullptr;
+        count = 0;
+        members = nullptr;
+    }
+
+    // Groups are numbered by their first member in 'ordered'
+    void build(const Resume* const* ordered, int n) {
+        destroy();
+        groups = new ResumeGroup[n > 0 ? n : 1];
+        members = new const Resume*[n > 0 ? n : 1];
+        int* groupOf = new int[n > 0 ? n : 1];
+        SignatureTable sets;
+        sets.init(n);
+        for (int i = 0; i < n; ++i) {
+            const Resume* r = ordered[i];
+            int g = sets.intern(r->skillIds, r->skillIdCount, 0);
+            if (g == count) {
+                groups[g].skillIds = r->skillIds;
+                groups[g].skillIdCount = r->skillIdCount;
+                groups[g].size = 0;
+                groups[g].minId = r->id;
+                ++count;
+            }
+            ++groups[g].size;
+            if (r->id < groups[g].minId) groups[g].minId = r->id;
+            groupOf[i] = g;
+        }
+        sets.destroy();
+
+        int next = 0;
+        for (int g = 0; g < count; ++g) {
+            groups[g].firstMember = next;
+            next += groups[g].size;
+        }
+        int* fill = new int[count > 0 ? count : 1];
+        for (int g = 0; g < count; ++g) fill[g] = groups[g].firstMember;
+        for (int i = 0; i < n; ++i) members[fill[groupOf[i]]++] = ordered[i];
+
+        delete[] fill;
+        delete[] groupOf;
+    }
+
+    void destroy() {
+        delete[] groups;
+        delete[] members;
+        init();
+    }
+};
+
+// ------------------- COMMAND LINE -------------------
+struct EngineOptions {
+    int threads;     // worker threads for parallel steps (1 = serial)
+    bool precompute; // evaluate every job once after indexing
+    bool background; // build the per-job aggregates while the menu runs
+};
+
+// [--quiet | --count-only | --output=FILE] [--threads=N] [--precompute]
+// [--background]. Returns false on bad arguments.
+inline bool parseEngineArgs(int argc, char* argv[], OutputSink& out, EngineOptions& opts) {
+    OutputMode mode = OUTPUT_CONSOLE;
+    const char* path = nullptr;
+    opts.threads = 1;
+    opts.precompute = false;
+    opts.background = false;
+    for (int i = 1; i < argc; ++i) {
+        const char* a = argv[i];
+        if (parseOutputOption(a, mode, path)) continue;
+        if (strncmp(a, "--threads=", 10) == 0 && atoi(a + 10) > 0) {
+            opts.threads = atoi(a + 10);
+            continue;
+        }
+        if (strcmp(a, "--precompute") == 0) {
+            opts.precompute = true;
+            continue;
+        }
+        if (strcmp(a, "--background") == 0) {
+            opts.background = true;
+            continue;
+        }
+        std::cerr << "Unknown option '" << a << "'\n";
+        std::cerr << "Usage: " << argv[0] << " [--quiet | --count-only | --output=FILE] [--threads=N] [--precompute] [--background]\n";
+        return false;
+    }
+    return out.init(mode, path);
+}
+
+#endif
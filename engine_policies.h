@@ -0,0 +1,603 @@
+// engine_policies.h
+// Storage, search and sort policies for the templated Engine (engine.h).
+//
+// Storage policies decide how jobs, resumes and result lists are held:
+//   ArrayStorage       fixed-capacity array (the array_list programs)
+//   LinkedListStorage  singly linked list (the linked_list programs)
+// Both expose the same Table<T> interface: init / append / clear / destroy and
+// cursor iteration with begin() / valid() / next() / at().
+//
+// Search policies find jobs by exact title key (substrings and resume ids go
+// through the engine's indexes):
+//   LinearSearch    any storage
+//   BinarySearch    ArrayStorage only (needs random access)
+//   SentinelSearch  any storage
+//
+// Sort policies sort a Table<T> with a "less" comparator or an integer key:
+//   QuickSort, MergeSort  (array and linked list versions of each)
+//   RadixMergeSort        ArrayStorage only
+//
+#ifndef ENGINE_POLICIES_H
+#define ENGINE_POLICIES_H
+
+#include "engine_common.h"
+#include "sort_primitives.h"
+
+// =================== STORAGE POLICIES ===================
+
+// ------------------- ARRAY STORAGE -------------------
+// Items never move once appended. Sorting permutes 'order', an array of 32-bit
+// indices, so a sort swaps ints instead of whole Job / Resume structs and the
+// pointers held by the index stay valid.
+struct ArrayStorage {
+    static const char* name() { return "Array"; }
+
+    template <class T>
+    struct Table {
+        T* items;     // capacity + 1 slots; items[capacity] is the sentinel slot
+        int* order;   // order[i] = index into items of the i-th element
+        int count;
+        int capacity;
+
+        typedef int Cursor;
+
+        void init(int cap) {
+            capacity = cap;
+            count = 0;
+            items = new T[cap + 1];
+            order = new int[cap + 1];
+        }
+
+        // Returns the slot to fill, or nullptr when the array is full
+        T* append() {
+            if (count >= capacity) return nullptr;
+            order[count] = count;
+            return &items[count++];
+        }
+
+        // Places the sentinel slot right after the last element and returns it
+        T& sentinel() {
+            order[count] = capacity;
+            return items[capacity];
+        }
+
+        int size() const { return count; }
+        void clear() { count = 0; }
+
+        void destroy() {
+            delete[] items;
+            delete[] order;
+            items = nullptr;
+            order = nullptr;
+            count = 0;
+            capacity = 0;
+        }
+
+        Cursor begin() const { return 0; }
+        bool valid(Cursor c) const { return c < count; }
+        Cursor next(Cursor c) const { return c + 1; }
+        T& at(Cursor c) { return items[order[c]]; }
+        const T& at(Cursor c) const { return items[order[c]]; }
+    };
+};
+
+// ------------------- LINKED LIST STORAGE -------------------
+struct LinkedListStorage {
+    static const char* name() { return "Linked List"; }
+
+    template <class T>
+    struct Node {
+        T value;
+        Node* next;
+    };
+
+    template <class T>
+    struct Table {
+        Node<T>* head;
+        Node<T>* tail;
+        int count;
+
+        typedef Node<T>* Cursor;
+
+        void init(int) {
+            head = tail = nullptr;
+            count = 0;
+        }
+
+        // Appends a new node at the tail and returns its value to fill
+        T* append() {
+            Node<T>* node = new Node<T>();
+            node->next = nullptr;
+            if (!head) head = tail = node;
+            else { tail->next = node; tail = node; }
+            ++count;
+            return &node->value;
+        }
+
+        int size() const { return count; }
+
+        void clear() {
+            while (head) {
+                Node<T>* tmp = head;
+                head = head->next;
+                delete tmp;
+            }
+            tail = nullptr;
+            count = 0;
+        }
+
+        void destroy() { clear(); }
+
+        // Used by the list sorts after they relink the nodes
+        void relink(Node<T>* newHead) {
+            head = newHead;
+            tail = newHead;
+            while (tail && tail->next) tail = tail->next;
+        }
+
+        Cursor begin() const { return head; }
+        bool valid(Cursor c) const { return c != nullptr; }
+        Cursor next(Cursor c) const { return c->next; }
+        T& at(Cursor c) { return c->value; }
+        const T& at(Cursor c) const { return c->value; }
+    };
+};
+
+// =================== SORT POLICIES ===================
+// Every policy provides:
+//   sort(table, less)                    order by a comparator
+//   sortByKey(table, key, descending)    order by an unsigned integer key (up to 64 bits)
+// Comparison sorts implement sortByKey with KeyLess; RadixMergeSort radix sorts.
+// The job title sort uses sortByKey; small bounded keys (skill counts, scores)
+// go through CountingSort instead, the same in every program.
+
+// Comparator over an unsigned integer key
+template <class KeyFn>
+struct KeyLess {
+    KeyFn key;
+    bool descending;
+
+    KeyLess(KeyFn k, bool desc) : key(k), descending(desc) {}
+
+    template <class T>
+    bool operator()(const T& a, const T& b) const {
+        return descending ? key(b) < key(a) : key(a) < key(b);
+    }
+};
+
+// ------------------- MERGE SORT -------------------
+struct MergeSort {
+    static const char* name() { return "Merge Sort"; }
+
+    template <class Table, class KeyFn>
+    static void sortByKey(Table& t, KeyFn key, bool descending) {
+        sort(t, KeyLess<KeyFn>(key, descending));
+    }
+
+    template <class T, class Less>
+    static void sortRange(T arr[], T tmp[], int low, int high, Less less) {
+        if (low >= high) return;
+        int mid = low + (high - low) / 2;
+        sortRange(arr, tmp, low, mid, less);
+        sortRange(arr, tmp, mid + 1, high, less);
+        int i = low, j = mid + 1, k = low;
+        while (i <= mid && j <= high) {
+            if (less(arr[j], arr[i])) tmp[k++] = arr[j++];
+            else tmp[k++] = arr[i++];
+        }
+        while (i <= mid) tmp[k++] = arr[i++];
+        while (j <= high) tmp[k++] = arr[j++];
+        for (k = low; k <= high; ++k) arr[k] = tmp[k];
+    }
+
+    template <class T, class Less>
+    static void sort(ArrayStorage::Table<T>& t, Less less) {
+        if (t.count < 2) return;
+        const T* items = t.items;
+        int* tmp = new int[t.count];
+        sortRange(t.order, tmp, 0, t.count - 1, [&](int a, int b) { return less(items[a], items[b]); });
+        delete[] tmp;
+    }
+
+    // Merges two sorted chains through a tail link; on ties 'a' goes first
+    template <class N, class Less>
+    static N* mergeLists(N* a, N* b, Less less) {
+        N* result = nullptr;
+        N** link = &result;
+        while (a && b) {
+            if (less(b->value, a->value)) {
+                *link = b;
+                link = &b->next;
+                b = b->next;
+            } else {
+                *link = a;
+                link = &a->next;
+                a = a->next;
+            }
+        }
+        *link = a ? a : b;
+        return result;
+    }
+
+    // Bottom-up: bins[i] holds a sorted run of 2^i nodes or is empty. Each node
+    // is carried up through the full bins like a binary counter, so the list is
+    // never split or walked to find its middle and the stack stays constant.
+    template <class N, class Less>
+    static N* sortList(N* head, Less less) {
+        const int BINS = 64;
+        N* bins[BINS];
+        int used = 0;
+        while (head) {
+            N* run = head;
+            head = head->next;
+            run->next = nullptr;
+            int i = 0;
+            while (i < used && bins[i]) {
+                run = mergeLists(bins[i], run, less); // older run first keeps it stable
+                bins[i] = nullptr;
+                ++i;
+            }
+            if (i == used) ++used;
+            bins[i] = run;
+        }
+        N* result = nullptr;
+        for (int i = 0; i < used; ++i) {
+            if (bins[i]) result = mergeLists(bins[i], result, less);
+        }
+        return result;
+    }
+
+    template <class T, class Less>
+    static void sort(LinkedListStorage::Table<T>& t, Less less) {
+        t.relink(sortList(t.head, less));
+    }
+};
+
+// ------------------- QUICK SORT -------------------
+struct QuickSort {
+    static const char* name() { return "Quick Sort"; }
+
+    template <class Table, class KeyFn>
+    static void sortByKey(Table& t, KeyFn key, bool descending) {
+        sort(t, KeyLess<KeyFn>(key, descending));
+    }
+
+    template <class T, class Less>
+    static void sortRange(T arr[], int low, int high, Less less) {
+        if (low >= high) return;
+        T pivot = arr[(low + high) / 2];
+        int i = low, j = high;
+        while (i <= j) {
+            while (less(arr[i], pivot)) i++;
+            while (less(pivot, arr[j])) j--;
+            if (i <= j) {
+                T tmp = arr[i]; arr[i] = arr[j]; arr[j] = tmp;
+                i++; j--;
+            }
+        }
+        if (low < j) sortRange(arr, low, j, less);
+        if (i < high) sortRange(arr, i, high, less);
+    }
+
+    // Equal elements compare by their current position, so the array sort is
+    // stable like every other policy's
+    template <class T, class Less>
+    static void sort(ArrayStorage::Table<T>& t, Less less) {
+        if (t.count < 2) return;
+        const T* items = t.items;
+        int* rank = new int[t.capacity + 1]; // by item index
+        for (int i = 0; i < t.count; ++i) rank[t.order[i]] = i;
+        sortRange(t.order, 0, t.count - 1, [&](int a, int b) {
+            if (less(items[a], items[b])) return true;
+            return !less(items[b], items[a]) && rank[a] < rank[b];
+        });
+        delete[] rank;
+    }
+
+    // ---- linked lists ----
+    // Introsort style: median-of-three pivot, three-way partition into
+    // less / equal / greater chains built with tail pointers, and a merge sort
+    // fallback once the recursion gets deeper than 2*log2(n). Equal keys
+    // (skill counts, scores) finish in one pass instead of going quadratic.
+    template <class N, class Less>
+    static N* medianOfThree(N* a, N* b, N* c, Less less) {
+        if (less(b->value, a->value)) { N* t = a; a = b; b = t; }
+        if (less(c->value, b->value)) {
+            b = c;
+            if (less(b->value, a->value)) b = a;
+        }
+        return b;
+    }
+
+    // Sorts a null-terminated chain of n nodes; returns its head and sets *tailOut
+    template <class N, class Less>
+    static N* sortChain(N* head, int n, int depthLeft, N** tailOut, Less less) {
+        if (n <= 1) {
+            *tailOut = head;
+            return head;
+        }
+        if (depthLeft == 0) {
+            head = MergeSort::sortList(head, less);
+            N* tail = head;
+            while (tail->next) tail = tail->next;
+            *tailOut = tail;
+            return head;
+        }
+
+        N* mid = head;
+        N* last = head;
+        for (int i = 1; i < n; ++i) {
+            last = last->next;
+            if (i == n / 2) mid = last;
+        }
+        N* pivot = medianOfThree(head, mid, last, less);
+
+        N *ltHead = nullptr, *ltTail = nullptr;
+        N *eqHead = nullptr, *eqTail = nullptr;
+        N *gtHead = nullptr, *gtTail = nullptr;
+        int nLess = 0, nGreater = 0;
+        for (N* cur = head; cur; ) {
+            N* next = cur->next;
+            cur->next = nullptr;
+            if (less(cur->value, pivot->value)) {
+                if (!ltHead) ltHead = cur; else ltTail->next = cur;
+                ltTail = cur;
+                ++nLess;
+            } else if (less(pivot->value, cur->value)) {
+                if (!gtHead) gtHead = cur; else gtTail->next = cur;
+                gtTail = cur;
+                ++nGreater;
+            } else {
+                if (!eqHead) eqHead = cur; else eqTail->next = cur;
+                eqTail = cur;
+            }
+            cur = next;
+        }
+
+        ltHead = sortChain(ltHead, nLess, depthLeft - 1, &ltTail, less);
+        gtHead = sortChain(gtHead, nGreater, depthLeft - 1, &gtTail, less);
+
+        N* result = eqHead;
+        if (ltHead) {
+            ltTail->next = eqHead;
+            result = ltHead;
+        }
+        eqTail->next = gtHead;
+        *tailOut = gtHead ? gtTail : eqTail;
+        return result;
+    }
+
+    template <class T, class Less>
+    static void sort(LinkedListStorage::Table<T>& t, Less less) {
+        if (!t.head) return;
+        int depthLimit = 0;
+        for (int n = t.count; n > 1; n >>= 1) depthLimit += 2;
+        t.head = sortChain(t.head, t.count, depthLimit, &t.tail, less);
+    }
+};
+
+// ------------------- RADIX / MERGE SORT -------------------
+// Array tables only. Integer keys (job title keys) are LSD radix sorted, low
+// 32 bits then high 32 bits; comparator sorts use the bottom-up merge sort.
+// Both are stable.
+struct RadixMergeSort {
+    static const char* name() { return "Radix Merge Sort"; }
+
+    template <class T, class Less>
+    static void sort(ArrayStorage::Table<T>& t, Less less) {
+        const T* items = t.items;
+        mergeSortIndices(t.order, t.count, [&](int a, int b) { return less(items[a], items[b]); });
+    }
+
+    template <class T, class KeyFn>
+    static void sortByKey(ArrayStorage::Table<T>& t, KeyFn key, bool descending) {
+        const T* items = t.items;
+        radixSortIndices(t.order, t.count, [&](int i) { return (unsigned int)key(items[i]); }, descending);
+        if (sizeof(key(items[0])) > sizeof(unsigned int)) {
+            radixSortIndices(t.order, t.count,
+                             [&](int i) { return (unsigned int)((unsigned long long)key(items[i]) >> 32); }, descending);
+        }
+    }
+};
+
+// ------------------- PARALLEL SORT -------------------
+// Large array tables are cut into slices that the program's own Sort policy
+// sorts on the engine's thread pool, then merged stably (sort_primitives.h).
+// Every policy's array sort is stable, so the order never depends on the
+// thread count. Small arrays, one thread and linked lists sort serially.
+// Both calls return the number of slices used (1 = serial).
+template <class Sort>
+struct ParallelSort {
+    template <class T, class Less>
+    static int sort(ArrayStorage::Table<T>& t, Less less, ThreadPool& pool) {
+        return sortSlices(t, less, pool, [&](ArrayStorage::Table<T>& slice) { Sort::sort(slice, less); });
+    }
+
+    template <class T, class Less>
+    static int sort(LinkedListStorage::Table<T>& t, Less less, ThreadPool&) {
+        Sort::sort(t, less);
+        return 1;
+    }
+
+    template <class T, class KeyFn>
+    static int sortByKey(ArrayStorage::Table<T>& t, KeyFn key, bool descending, ThreadPool& pool) {
+        return sortSlices(t, KeyLess<KeyFn>(key, descending), pool,
+                          [&](ArrayStorage::Table<T>& slice) { Sort::sortByKey(slice, key, descending); });
+    }
+
+    template <class T, class KeyFn>
+    static int sortByKey(LinkedListStorage::Table<T>& t, KeyFn key, bool descending, ThreadPool&) {
+        Sort::sortByKey(t, key, descending);
+        return 1;
+    }
+
+private:
+    // A slice is a table sharing t's items with order pointing into t.order;
+    // it is never destroyed
+    template <class T, class Less, class SortTable>
+    static int sortSlices(ArrayStorage::Table<T>& t, Less less, ThreadPool& pool, SortTable sortTable) {
+        int parts = parallelSortParts(t.count, pool.size());
+        if (parts < 2) {
+            sortTable(t);
+            return 1;
+        }
+        const T* items = t.items;
+        parallelSortIndices(t.order, t.count, parts, pool,
+                            [&](int* idx, int n) {
+                                ArrayStorage::Table<T> slice = t;
+                                slice.order = idx;
+                                slice.count = n;
+                                sortTable(slice);
+                            },
+                            [&](int a, int b) { return less(items[a], items[b]); });
+        return parts;
+    }
+};
+
+// ------------------- COUNTING SORT -------------------
+// Stable sort for small bounded keys in 0..maxKey (skill counts, scores, ids).
+// Every engine uses it for those keys whatever its Sort policy; ties keep their
+// input order, so results rank the same in every variant.
+struct CountingSort {
+    template <class T, class KeyFn>
+    static void sort(ArrayStorage::Table<T>& t, KeyFn key, int maxKey, bool descending) {
+        int n = t.count;
+        if (n < 2) return;
+        const T* items = t.items;
+        int* pos = new int[maxKey + 2];
+        for (int b = 0; b <= maxKey + 1; ++b) pos[b] = 0;
+        for (int i = 0; i < n; ++i) {
+            int k = key(items[t.order[i]]);
+            ++pos[(descending ? maxKey - k : k) + 1];
+        }
+        for (int b = 0; b <= maxKey; ++b) pos[b + 1] += pos[b];
+        int* sorted = new int[n];
+        for (int i = 0; i < n; ++i) {
+            int k = key(items[t.order[i]]);
+            sorted[pos[descending ? maxKey - k : k]++] = t.order[i];
+        }
+        for (int i = 0; i < n; ++i) t.order[i] = sorted[i];
+        delete[] sorted;
+        delete[] pos;
+    }
+
+    // Nodes are appended to one chain per key, then the chains are joined
+    template <class T, class KeyFn>
+    static void sort(LinkedListStorage::Table<T>& t, KeyFn key, int maxKey, bool descending) {
+        typedef LinkedListStorage::Node<T> N;
+        if (!t.head || !t.head->next) return;
+        N** heads = new N*[maxKey + 1];
+        N** tails = new N*[maxKey + 1];
+        for (int b = 0; b <= maxKey; ++b) heads[b] = tails[b] = nullptr;
+        for (N* cur = t.head; cur; ) {
+            N* next = cur->next;
+            int k = key(cur->value);
+            int b = descending ? maxKey - k : k;
+            cur->next = nullptr;
+            if (!heads[b]) heads[b] = tails[b] = cur;
+            else { tails[b]->next = cur; tails[b] = cur; }
+            cur = next;
+        }
+        t.head = t.tail = nullptr;
+        for (int b = 0; b <= maxKey; ++b) {
+            if (!heads[b]) continue;
+            if (!t.head) t.head = heads[b];
+            else t.tail->next = heads[b];
+            t.tail = tails[b];
+        }
+        delete[] heads;
+        delete[] tails;
+    }
+};
+
+// =================== SEARCH POLICIES ===================
+// Every policy provides:
+//   findJobsExact(jobs, titleKey, out)       all jobs whose titleKey matches
+// Substring title search (TitleGramIndex) and resume ids (ResumeIdIndex) are
+// answered by the engine's indexes, the same way for every policy.
+
+// ------------------- LINEAR SEARCH -------------------
+struct LinearSearch {
+    static const char* name() { return "Linear Search"; }
+
+    template <class Table>
+    static void findJobsExact(Table& jobs, unsigned long long qKey, DynArray<const Job*>& out) {
+        out.clear();
+        for (auto c = jobs.begin(); jobs.valid(c); c = jobs.next(c)) {
+            if (jobs.at(c).titleKey == qKey) out.push(&jobs.at(c));
+        }
+    }
+};
+
+// ------------------- BINARY SEARCH -------------------
+// Needs jobs sorted by titleKey.
+struct BinarySearch {
+    static const char* name() { return "Binary Search"; }
+
+    // Binary search for exact job title match (returns first occurrence)
+    static int firstJobExact(const ArrayStorage::Table<Job>& jobs, unsigned long long qKey) {
+        int left = 0, right = jobs.count - 1;
+        int result = -1;
+        while (left <= right) {
+            int mid = left + (right - left) / 2;
+            unsigned long long key = jobs.at(mid).titleKey;
+            if (key == qKey) {
+                result = mid;
+                right = mid - 1; // Continue searching left for first occurrence
+            } else if (key < qKey) {
+                left = mid + 1;
+            } else {
+                right = mid - 1;
+            }
+        }
+        return result;
+    }
+
+    static void findJobsExact(ArrayStorage::Table<Job>& jobs, unsigned long long qKey, DynArray<const Job*>& out) {
+        out.clear();
+        int first = firstJobExact(jobs, qKey);
+        if (first == -1) return;
+        for (int i = first; i < jobs.count && jobs.at(i).titleKey == qKey; ++i) {
+            out.push(&jobs.at(i));
+        }
+    }
+};
+
+// ------------------- SENTINEL SEARCH -------------------
+// The target is planted after the last element so the scan loops have no end check.
+// Arrays use the spare sentinel slot; lists overwrite the tail and restore it.
+struct SentinelSearch {
+    static const char* name() { return "Sentinel Search"; }
+
+    static void findJobsExact(ArrayStorage::Table<Job>& jobs, unsigned long long qKey, DynArray<const Job*>& out) {
+        out.clear();
+        jobs.sentinel().titleKey = qKey;
+        int n = jobs.count;
+        int i = 0;
+        while (true) {
+            while (jobs.at(i).titleKey != qKey) ++i;
+            if (i == n) break;
+            out.push(&jobs.at(i));
+            ++i;
+        }
+    }
+
+    static void findJobsExact(LinkedListStorage::Table<Job>& jobs, unsigned long long qKey, DynArray<const Job*>& out) {
+        out.clear();
+        LinkedListStorage::Node<Job>* tail = jobs.tail;
+        if (!tail) return;
+        unsigned long long backupKey = tail->value.titleKey;
+        tail->value.titleKey = qKey;
+        LinkedListStorage::Node<Job>* cur = jobs.head;
+        while (true) {
+            while (cur->value.titleKey != qKey) cur = cur->next;
+            if (cur == tail) break;
+            out.push(&cur->value);
+            cur = cur->next;
+        }
+        tail->value.titleKey = backupKey;
+        if (backupKey == qKey) out.push(&tail->value);
+    }
+};
+
+#endif
@@ -0,0 +1,151 @@
+// output_sink.h
+// Result output sink shared by the array and linked list programs.
+//
+// Result listings (the "first 1000" dumps and every search result) are written
+// through an OutputSink instead of straight to cout, so the step timings measure
+// the algorithm rather than the terminal. Status lines and step statistics still
+// go to cout.
+//
+// Modes (selected on the command line):
+//   (default)        console: results go to stdout through a 1 MB buffer
+//   --quiet          results are discarded
+//   --count-only     results are discarded but counted; the count is shown per step
+//   --output=FILE    results go to FILE through a 1 MB buffer
+//
+#ifndef OUTPUT_SINK_H
+#define OUTPUT_SINK_H
+
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include <string>
+
+enum OutputMode {
+    OUTPUT_CONSOLE,
+    OUTPUT_QUIET,
+    OUTPUT_COUNT_ONLY,
+    OUTPUT_FILE
+};
+
+const size_t OUTPUT_BUFFER_SIZE = 1 << 20; // 1 MB
+
+struct OutputSink {
+    OutputMode mode;
+    FILE* fp;
+    char* buffer;
+    size_t used;
+    long long lines; // result lines written since the last endStep()
+
+    bool init(OutputMode m, const char* path) {
+        mode = m;
+        fp = nullptr;
+        buffer = nullptr;
+        used = 0;
+        lines = 0;
+        if (mode == OUTPUT_CONSOLE) {
+            fp = stdout;
+        } else if (mode == OUTPUT_FILE) {
+            fp = fopen(path, "w");
+            if (!fp) {
+                std::cerr << "Error: cannot open output file '" << path << "'\n";
+                return false;
+            }
+        }
+        if (fp) buffer = new char[OUTPUT_BUFFER_SIZE];
+        return true;
+    }
+
+    // True when the text is actually stored somewhere (console or file).
+    bool writing() const {
+        return buffer != nullptr;
+    }
+
+    void write(const char* s, size_t n) {
+        for (size_t i = 0; i < n; ++i) {
+            if (s[i] == '\n') ++lines;
+        }
+        if (!buffer) return;
+        if (used + n > OUTPUT_BUFFER_SIZE) flush();
+        if (n > OUTPUT_BUFFER_SIZE) {
+            fwrite(s, 1, n, fp);
+            return;
+        }
+        memcpy(buffer + used, s, n);
+        used += n;
+    }
+
+    void flush() {
+        if (!fp) return;
+        // Keep ordering with anything already queued on cout
+        if (mode == OUTPUT_CONSOLE) std::cout.flush();
+        if (used > 0) fwrite(buffer, 1, used, fp);
+        used = 0;
+        fflush(fp);
+    }
+
+    // Call at the end of each timed step, before its statistics are printed.
+    void endStep() {
+        flush();
+        if (mode == OUTPUT_COUNT_ONLY) {
+            std::cout << "Result lines: " << lines << "\n";
+        }
+        lines = 0;
+    }
+
+    void destroy() {
+        flush();
+        if (fp && fp != stdout) fclose(fp);
+        fp = nullptr;
+        delete[] buffer;
+        buffer = nullptr;
+    }
+};
+
+inline OutputSink& operator<<(OutputSink& out, const std::string& s) {
+    out.write(s.data(), s.size());
+    return out;
+}
+
+inline OutputSink& operator<<(OutputSink& out, const char* s) {
+    out.write(s, strlen(s));
+    return out;
+}
+
+inline OutputSink& operator<<(OutputSink& out, char c) {
+    out.write(&c, 1);
+    return out;
+}
+
+inline OutputSink& operator<<(OutputSink& out, long long v) {
+    if (!out.writing()) return out; // numbers never contain a newline
+    char tmp[24];
+    int n = snprintf(tmp, sizeof(tmp), "%lld", v);
+    out.write(tmp, (size_t)n);
+    return out;
+}
+
+inline OutputSink& operator<<(OutputSink& out, int v) {
+    return out << (long long)v;
+}
+
+inline OutputSink& operator<<(OutputSink& out, long v) {
+    return out << (long long)v;
+}
+
+// Parses one of --quiet / --count-only / --output=FILE. Returns false if 'a' is
+// not an output option.
+inline bool parseOutputOption(const char* a, OutputMode& mode, const char*& path) {
+    if (strcmp(a, "--quiet") == 0) {
+        mode = OUTPUT_QUIET;
+    } else if (strcmp(a, "--count-only") == 0) {
+        mode = OUTPUT_COUNT_ONLY;
+    } else if (strncmp(a, "--output=", 9) == 0 && a[9] != '\0') {
+        mode = OUTPUT_FILE;
+        path = a + 9;
+    } else {
+        return false;
+    }
+    return true;
+}
+
+#endif
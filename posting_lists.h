@@ -0,0 +1,434 @@
+// posting_lists.h
+// Posting lists of ascending ints (job positions, resume groups) in two encodings.
+//
+// CompressedPostings: block-compressed lists for sequential reads.
+//
+//   CompressedPostings cp;
+//   cp.build(values, listStart, lists);       // list l = values[listStart[l], listStart[l + 1])
+//   for (PostingCursor c = cp.open(l); c.valid(); c.next()) use(c.value);
+//   c.skipTo(target);                         // first value >= target, via the skip table
+//   cp.destroy();
+//
+// Each list is cut into blocks of POSTING_BLOCK values. A block's first value is
+// kept raw in the skip table next to the byte offset of the rest, which are
+// LEB128 varint deltas (7 bits per byte, high bit = more bytes follow). Dense
+// lists therefore cost about one byte per entry instead of four or eight, and
+// skipTo() gallops over block heads before decoding a single block.
+// Lists may repeat a value (delta 0); skipTo() stops at the first copy, which
+// debug builds check against a linear scan after build().
+//
+// RoaringPostings: roaring-style sets for unions, values distinct.
+//
+//   RoaringPostings rp;
+//   rp.build(values, listStart, lists);
+//   rp.unionOf(lists, k, bits, emit);         // emit(v) once per value in any list
+//
+// Values are split into 64K chunks by their high 16 bits. A chunk holding up to
+// ROARING_ARRAY_MAX values is a sorted array of the low 16 bits (2 bytes each);
+// a fuller one is a 65536-bit bitmap (8 KB flat), so rare skills stay small and
+// ubiquitous ones cost one bit per entry. unionOf() plans from the container
+// sizes: few values are scattered into the caller's bitmap one by one, many are
+// OR-ed in whole words and read back with count-trailing-zeros.
+//
+#ifndef POSTING_LISTS_H
+#define POSTING_LISTS_H
+
+#include <cassert>
+#if defined(_MSC_VER)
+    #include <intrin.h>
+#endif
+
+const int POSTING_BLOCK = 128;
+const int ROARING_ARRAY_MAX = 4096;    // fuller chunks become bitmaps
+const int ROARING_BITMAP_WORDS = 1024; // 65536 bits
+
+inline int varintSize(unsigned int v) {
+    int n = 1;
+    while (v >= 0x80) { v >>= 7; ++n; }
+    return n;
+}
+
+inline unsigned char* writeVarint(unsigned char* out, unsigned int v) {
+    while (v >= 0x80) {
+        *out++ = (unsigned char)(v | 0x80);
+        v >>= 7;
+    }
+    *out++ = (unsigned char)v;
+    return out;
+}
+
+inline unsigned int readVarint(const unsigned char*& in) {
+    unsigned int v = *in & 0x7F;
+    int shift = 7;
+    while (*in++ & 0x80) {
+        v |= (unsigned int)(*in & 0x7F) << shift;
+        shift += 7;
+    }
+    return v;
+}
+
+struct CompressedPostings;
+
+// Walks one list; 'value' is the current entry while valid()
+struct PostingCursor {
+    const CompressedPostings* cp;
+    const unsigned char* at; // next delta of the current block
+    int block;               // current block
+    int inBlock;             // entries of the current block after 'value'
+    int left;                // entries of the list from 'value' on
+    int value;
+
+    bool valid() const { return left > 0; }
+    inline void next();
+    inline void skipTo(int target);
+
+private:
+    inline void enterBlock(int b);
+};
+
+struct CompressedPostings {
+    unsigned char* bytes;
+    int* blockFirst;    // first value of each block
+    int* blockOffset;   // byte offset of each block's deltas
+    int* listBlock;     // list l owns blocks [listBlock[l], listBlock[l + 1])
+    int* listSize;
+    int lists;
+    long long byteCount;
+
+    void init() {
+        bytes = nullptr;
+        blockFirst = blockOffset = listBlock = listSize = nullptr;
+        lists = 0;
+        byteCount = 0;
+    }
+
+    // Two passes: size every block exactly, then encode into arrays that have
+    // no growth slack
+    void build(const int* values, const int* listStart, int listCount) {
+        destroy();
+        lists = listCount;
+        listBlock = new int[lists + 1];
+        listSize = new int[lists > 0 ? lists : 1];
+        int blocks = 0;
+        byteCount = 0;
+        for (int l = 0; l < lists; ++l) {
+            int lo = listStart[l], hi = listStart[l + 1];
+            listBlock[l] = blocks;
+            listSize[l] = hi - lo;
+            blocks += (hi - lo + POSTING_BLOCK - 1) / POSTING_BLOCK;
+            for (int i = lo; i < hi; ++i) {
+                if ((i - lo) % POSTING_BLOCK != 0) byteCount += varintSize((unsigned int)(values[i] - values[i - 1]));
+            }
+        }
+        listBlock[lists] = blocks;
+
+        bytes = new unsigned char[byteCount > 0 ? byteCount : 1];
+        blockFirst = new int[blocks > 0 ? blocks : 1];
+        blockOffset = new int[blocks > 0 ? blocks : 1];
+        unsigned char* out = bytes;
+        int b = 0;
+        for (int l = 0; l < lists; ++l) {
+            for (int i = listStart[l]; i < listStart[l + 1]; ++i) {
+                if ((i - listStart[l]) % POSTING_BLOCK == 0) {
+                    blockFirst[b] = values[i];
+                    blockOffset[b] = (int)(out - bytes);
+                    ++b;
+                } else {
+                    out = writeVarint(out, (unsigned int)(values[i] - values[i - 1]));
+                }
+            }
+        }
+        assert(skipToMatchesScan());
+    }
+
+    // Debug check of skipTo() against a linear scan: from the start of each
+    // list, every value and every gap below one must land on the value's first
+    // copy, repeats included
+    bool skipToMatchesScan() const {
+        for (int l = 0; l < lists; ++l) {
+            bool first = true;
+            int prev = 0;
+            for (PostingCursor scan = open(l); scan.valid(); scan.next()) {
+                if (!first && scan.value == prev) continue;
+                int targets[2] = {scan.value, prev + 1};
+                for (int k = 0; k < (first || prev + 1 == scan.value ? 1 : 2); ++k) {
+                    PostingCursor c = open(l);
+                    c.skipTo(targets[k]);
+                    if (!c.valid() || c.value != scan.value || c.left != scan.left) return false;
+                }
+                first = false;
+                prev = scan.value;
+            }
+        }
+        return true;
+    }
+
+    int size(int l) const { return listSize[l]; }
+
+    PostingCursor open(int l) const {
+        PostingCursor c;
+        c.cp = this;
+        c.left = listSize[l];
+        c.block = listBlock[l];
+        c.at = nullptr;
+        c.inBlock = 0;
+        c.value = 0;
+        if (c.left > 0) {
+            c.value = blockFirst[c.block];
+            c.at = bytes + blockOffset[c.block];
+            c.inBlock = (c.left < POSTING_BLOCK ? c.left : POSTING_BLOCK) - 1;
+        }
+        return c;
+    }
+
+    // Compressed size in bytes, skip table included
+    long long memoryBytes() const {
+        return byteCount + (long long)listBlock[lists] * 2 * sizeof(int) + (long long)lists * 2 * sizeof(int);
+    }
+
+    void destroy() {
+        delete[] bytes;
+        delete[] blockFirst;
+        delete[] blockOffset;
+        delete[] listBlock;
+        delete[] listSize;
+        init();
+    }
+};
+
+inline void PostingCursor::enterBlock(int b) {
+    block = b;
+    value = cp->blockFirst[b];
+    at = cp->bytes + cp->blockOffset[b];
+    inBlock = (left < POSTING_BLOCK ? left : POSTING_BLOCK) - 1;
+}
+
+inline void PostingCursor::next() {
+    if (--left == 0) return;
+    if (inBlock > 0) {
+        value += (int)readVarint(at);
+        --inBlock;
+    } else {
+        enterBlock(block + 1);
+    }
+}
+
+// Gallops over the heads of the blocks still ahead to the last one starting
+// below 'target', then decodes forward inside it. A block starting at 'target'
+// itself may follow copies of it at the end of the previous block.
+inline void PostingCursor::skipTo(int target) {
+    if (!valid() || value >= target) return;
+    int lastBlock = block + (left - inBlock - 1 + POSTING_BLOCK - 1) / POSTING_BLOCK; // last block of the list
+    int lo = block, step = 1, hi = block + 1;
+    while (hi <= lastBlock && cp->blockFirst[hi] < target) {
+        lo = hi;
+        step *= 2;
+        hi = lo + step;
+    }
+    if (hi > lastBlock) hi = lastBlock + 1;
+    while (hi - lo > 1) { // blockFirst[lo] < target, blockFirst[hi] >= target or past the end
+        int mid = lo + (hi - lo) / 2;
+        if (cp->blockFirst[mid] < target) lo = mid;
+        else hi = mid;
+    }
+    if (lo > block) {
+        left -= inBlock + 1 + (lo - block - 1) * POSTING_BLOCK;
+        enterBlock(lo);
+    }
+    while (valid() && value < target) next();
+}
+
+// Index of the lowest set bit; w != 0
+inline int lowestBit(unsigned long long w) {
+#if defined(_MSC_VER)
+    unsigned long i;
+    _BitScanForward64(&i, w);
+    return (int)i;
+#else
+    return __builtin_ctzll(w);
+#endif
+}
+
+struct RoaringChunk {
+    int key;          // high 16 bits of its values
+    int cardinality;
+    int offset;       // into arrayValues, or into bitmapWords for a bitmap
+    bool bitmap;
+};
+
+struct RoaringPostings {
+    RoaringChunk* chunks;
+    int* listChunk;               // list l owns chunks [listChunk[l], listChunk[l + 1])
+    int* listSize;
+    unsigned short* arrayValues;
+    unsigned long long* bitmapWords;
+    int lists;
+    long long arrayCount;
+    long long wordCount;
+
+    void init() {
+        chunks = nullptr;
+        listChunk = listSize = nullptr;
+        arrayValues = nullptr;
+        bitmapWords = nullptr;
+        lists = 0;
+        arrayCount = wordCount = 0;
+    }
+
+    // Two passes, like CompressedPostings: count the chunks and their kinds,
+    // then fill exactly sized arenas. Each list must be strictly ascending.
+    void build(const int* values, const int* listStart, int listCount) {
+        destroy();
+        lists = listCount;
+        listChunk = new int[lists + 1];
+        listSize = new int[lists > 0 ? lists : 1];
+        int chunkCount = 0;
+        for (int pass = 0; pass < 2; ++pass) {
+            int c = 0;
+            long long arrays = 0, words = 0;
+            for (int l = 0; l < lists; ++l) {
+                listChunk[l] = c;
+                listSize[l] = listStart[l + 1] - listStart[l];
+                int i = listStart[l];
+                while (i < listStart[l + 1]) {
+                    int key = values[i] >> 16;
+                    int j = i;
+                    while (j < listStart[l + 1] && (values[j] >> 16) == key) ++j;
+                    bool bitmap = j - i > ROARING_ARRAY_MAX;
+                    if (pass == 1) {
+                        RoaringChunk& ch = chunks[c];
+                        ch.key = key;
+                        ch.cardinality = j - i;
+                        ch.bitmap = bitmap;
+                        ch.offset = (int)(bitmap ? words : arrays);
+                        if (bitmap) {
+                            unsigned long long* w = bitmapWords + words;
+                            for (int k = 0; k < ROARING_BITMAP_WORDS; ++k) w[k] = 0;
+                            for (int k = i; k < j; ++k) w[(values[k] & 0xFFFF) >> 6] |= 1ULL << (values[k] & 63);
+                        } else {
+                            for (int k = i; k < j; ++k) arrayValues[arrays + (k - i)] = (unsigned short)(values[k] & 0xFFFF);
+                        }
+                    }
+                    if (bitmap) words += ROARING_BITMAP_WORDS;
+                    else arrays += j - i;
+                    ++c;
+                    i = j;
+                }
+            }
+            listChunk[lists] = c;
+            if (pass == 0) {
+                chunkCount = c;
+                arrayCount = arrays;
+                wordCount = words;
+                chunks = new RoaringChunk[chunkCount > 0 ? chunkCount : 1];
+                arrayValues = new unsigned short[arrayCount > 0 ? arrayCount : 1];
+                bitmapWords = new unsigned long long[wordCount > 0 ? wordCount : 1];
+            }
+        }
+    }
+
+    int size(int l) const { return listSize[l]; }
+
+    // Every value of lists[0..k) once, ascending on the bitmap path. 'bits' is
+    // the caller's all-zero bitmap covering every value; it is zero again on return.
+    template <class Emit>
+    void unionOf(const int* ls, int k, unsigned long long* bits, Emit emit) const {
+        // Cost model in word operations: scattering pays per value (test, set,
+        // emit, clear), OR-ing pays per container word plus reading the covered
+        // range back
+        long long scatterCost = 0, orCost = 0;
+        int lowKey = 1 << 16, highKey = -1;
+        for (int q = 0; q < k; ++q) {
+            for (int c = listChunk[ls[q]]; c < listChunk[ls[q] + 1]; ++c) {
+                const RoaringChunk& ch = chunks[c];
+                scatterCost += 3LL * ch.cardinality + (ch.bitmap ? ROARING_BITMAP_WORDS : 0);
+                orCost += ch.bitmap ? ROARING_BITMAP_WORDS : ch.cardinality;
+                if (ch.key < lowKey) lowKey = ch.key;
+                if (ch.key > highKey) highKey = ch.key;
+            }
+        }
+        if (highKey < 0) return;
+        orCost += (long long)(highKey - lowKey + 1) * ROARING_BITMAP_WORDS;
+
+        if (scatterCost <= orCost) {
+            for (int q = 0; q < k; ++q) {
+                for (int c = listChunk[ls[q]]; c < listChunk[ls[q] + 1]; ++c) {
+                    forEachInChunk(chunks[c], [&](int v) {
+                        unsigned long long m = 1ULL << (v & 63);
+                        if (bits[v >> 6] & m) return;
+                        bits[v >> 6] |= m;
+                        emit(v);
+                    });
+                }
+            }
+            for (int q = 0; q < k; ++q) {
+                for (int c = listChunk[ls[q]]; c < listChunk[ls[q] + 1]; ++c) {
+                    forEachInChunk(chunks[c], [&](int v) { bits[v >> 6] = 0; });
+                }
+            }
+            return;
+        }
+
+        for (int q = 0; q < k; ++q) {
+            for (int c = listChunk[ls[q]]; c < listChunk[ls[q] + 1]; ++c) {
+                const RoaringChunk& ch = chunks[c];
+                int base = ch.key << 16;
+                if (ch.bitmap) {
+                    unsigned long long* out = bits + (base >> 6);
+                    const unsigned long long* in = bitmapWords + ch.offset;
+                    for (int w = 0; w < ROARING_BITMAP_WORDS; ++w) out[w] |= in[w];
+                } else {
+                    const unsigned short* in = arrayValues + ch.offset;
+                    for (int i = 0; i < ch.cardinality; ++i) {
+                        int v = base | in[i];
+                        bits[v >> 6] |= 1ULL << (v & 63);
+                    }
+                }
+            }
+        }
+        for (long long w = (long long)lowKey * ROARING_BITMAP_WORDS; w < (long long)(highKey + 1) * ROARING_BITMAP_WORDS; ++w) {
+            unsigned long long word = bits[w];
+            if (!word) continue;
+            bits[w] = 0;
+            while (word) {
+                emit((int)(w << 6) + lowestBit(word));
+                word &= word - 1;
+            }
+        }
+    }
+
+    long long memoryBytes() const {
+        return arrayCount * (long long)sizeof(unsigned short) + wordCount * (long long)sizeof(unsigned long long) +
+               (long long)listChunk[lists] * sizeof(RoaringChunk) + (long long)lists * 2 * sizeof(int);
+    }
+
+    void destroy() {
+        delete[] chunks;
+        delete[] listChunk;
+        delete[] listSize;
+        delete[] arrayValues;
+        delete[] bitmapWords;
+        init();
+    }
+
+private:
+    template <class Visit>
+    void forEachInChunk(const RoaringChunk& ch, Visit visit) const {
+        int base = ch.key << 16;
+        if (ch.bitmap) {
+            const unsigned long long* in = bitmapWords + ch.offset;
+            for (int w = 0; w < ROARING_BITMAP_WORDS; ++w) {
+                unsigned long long word = in[w];
+                while (word) {
+                    visit(base + (w << 6) + lowestBit(word));
+                    word &= word - 1;
+                }
+            }
+        } else {
+            const unsigned short* in = arrayValues + ch.offset;
+            for (int i = 0; i < ch.cardinality; ++i) visit(base | in[i]);
+        }
+    }
+};
+
+#endif
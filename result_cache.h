@@ -0,0 +1,156 @@
+// result_cache.h
+// Bounded LRU cache of search results, keyed by query type and normalized query.
+//
+//   LruCache<SearchResult> cache;
+//   cache.init(RESULT_CACHE_ENTRIES);
+//   SearchResult* r = cache.find(key);        // null on a miss; a hit becomes most recent
+//   if (!r) { r = cache.insert(key); ... }    // evicts the least recent entry when full
+//   cache.clear();                            // drop every entry, e.g. after a reload
+//   cache.destroy();
+//
+// Entries live in one fixed array, linked most recent first; a chained hash
+// table over the same array finds them by key. Values are reused on eviction,
+// so V provides init(), clear() and destroy(). Counters cover every find().
+//
+#ifndef RESULT_CACHE_H
+#define RESULT_CACHE_H
+
+#include "engine_common.h"
+
+// Ranked results of one search, as listed (queries print them with their own
+// raw text, so two spellings of one query share an entry)
+struct SearchResult {
+    int found;                       // title: matching jobs; skill: resumes with it; candidate: 1 if the id exists
+    int total;                       // skill: jobs with the skill
+    DynArray<JobCount> jobs;         // title / skill: listed jobs, in order
+    DynArray<CandidateScore> scores; // title: each listed job's top candidates, back to back; candidate: job scores
+    DynArray<int> scoreStart;        // title: jobs[i]'s candidates are scores[scoreStart[i], scoreStart[i + 1])
+
+    void init() {
+        found = total = 0;
+        jobs.init(16);
+        scores.init(16);
+        scoreStart.init(8);
+    }
+
+    void clear() {
+        found = total = 0;
+        jobs.clear();
+        scores.clear();
+        scoreStart.clear();
+    }
+
+    void destroy() {
+        jobs.destroy();
+        scores.destroy();
+        scoreStart.destroy();
+    }
+};
+
+template <class V>
+struct LruCache {
+    struct Entry {
+        std::string key;
+        unsigned int hash;
+        int prev, next;  // recency list, -1 at the ends
+        int chain;       // next entry in the same hash bucket, -1 at the end
+        V value;
+    };
+
+    Entry* entries;
+    int capacity;
+    int count;
+    int head, tail;      // most / least recently used
+    int* buckets;        // power-of-two count, -1 = empty
+    int bucketMask;
+    long long hits;
+    long long misses;
+
+    void init(int cap) {
+        capacity = cap > 0 ? cap : 1;
+        entries = new Entry[capacity];
+        for (int i = 0; i < capacity; ++i) entries[i].value.init();
+        int n = 1;
+        while (n < 2 * capacity) n <<= 1;
+        buckets = new int[n];
+        bucketMask = n - 1;
+        hits = misses = 0;
+        clear();
+    }
+
+    V* find(const std::string& key) {
+        unsigned int h = hashString(key);
+        for (int e = buckets[h & bucketMask]; e >= 0; e = entries[e].chain) {
+            if (entries[e].hash == h && entries[e].key == key) {
+                ++hits;
+                unlink(e);
+                pushFront(e);
+                return &entries[e].value;
+            }
+        }
+        ++misses;
+        return nullptr;
+    }
+
+    // Key must not be cached yet; the returned value is cleared
+    V* insert(const std::string& key) {
+        int e;
+        if (count < capacity) {
+            e = count++;
+        } else {
+            e = tail;
+            unlink(e);
+            unchain(e);
+        }
+        Entry& entry = entries[e];
+        entry.key = key;
+        entry.hash = hashString(key);
+        entry.value.clear();
+        int& bucket = buckets[entry.hash & bucketMask];
+        entry.chain = bucket;
+        bucket = e;
+        pushFront(e);
+        return &entry.value;
+    }
+
+    void clear() {
+        count = 0;
+        head = tail = -1;
+        for (int b = 0; b <= bucketMask; ++b) buckets[b] = -1;
+    }
+
+    void destroy() {
+        if (!entries) return;
+        for (int i = 0; i < capacity; ++i) entries[i].value.destroy();
+        delete[] entries;
+        delete[] buckets;
+        entries = nullptr;
+        buckets = nullptr;
+        count = 0;
+    }
+
+private:
+    void unlink(int e) {
+        Entry& entry = entries[e];
+        if (entry.prev >= 0) entries[entry.prev].next = entry.next;
+        else head = entry.next;
+        if (entry.next >= 0) entries[entry.next].prev = entry.prev;
+        else tail = entry.prev;
+    }
+
+    void pushFront(int e) {
+        entries[e].prev = -1;
+        entries[e].next = head;
+        if (head >= 0) entries[head].prev = e;
+        head = e;
+        if (tail < 0) tail = e;
+    }
+
+    void unchain(int e) {
+        int* link = &buckets[entries[e].hash & bucketMask];
+        while (*link != e) link = &entries[*link].chain;
+        *link = entries[e].chain;
+    }
+};
+
+#endif
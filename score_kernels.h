@@ -0,0 +1,156 @@
+// score_kernels.h
+// Job -> resume scoring: score = round(100 * matches / job.skillCount), where
+// matches counts the job's skills found in the resume's skills. Resumes with
+// the same skill set are scored once, as a ResumeGroup (engine_common.h).
+//
+// Both sides hold their skills as sorted SkillDictionary ids (engine_common.h):
+// the job keeps repeated skills, the group keeps each skill once. matches is
+// then a single merge of two short int arrays. Most jobs have only a handful of
+// skill ids, so for 1..MAX_UNROLLED_SKILLS the loop over the job's ids is
+// unrolled at compile time; longer jobs use a merge written without
+// data-dependent branches. scoreKernelFor(job) picks the kernel once per job;
+// the loop over candidates then calls it directly. The
+// rounded percentage comes from a (total, matches) lookup table instead of a
+// double division and round() per candidate.
+//
+// ScoreCache memoizes scores by (job signature, resume group): jobs with the
+// same skills and resume groups both repeat heavily, so most scores after the
+// first queries are one byte load.
+//
+#ifndef SCORE_KERNELS_H
+#define SCORE_KERNELS_H
+
+#include <atomic>
+#include "engine_common.h"
+
+const int MAX_UNROLLED_SKILLS = 8;
+
+// pct[total][matches] = round(100 * matches / total), halves rounded up
+struct PercentTable {
+    unsigned char pct[MAX_SKILLS + 1][MAX_SKILLS + 1];
+
+    PercentTable() {
+        for (int t = 0; t <= MAX_SKILLS; ++t) {
+            for (int m = 0; m <= MAX_SKILLS; ++m) {
+                pct[t][m] = (t == 0 || m > t) ? 0 : (unsigned char)((200 * m + t) / (2 * t));
+            }
+        }
+    }
+};
+
+inline const PercentTable PERCENT_TABLE;
+
+typedef int (*ScoreKernel)(const Job& job, const ResumeGroup& g);
+
+// Elements of a[0..na) found in b[0..nb); both ascending, b without repeats.
+// An equal pair advances only 'a', so a repeated job skill counts each time.
+inline int countSortedMatches(const int* a, int na, const int* b, int nb) {
+    int i = 0, j = 0, matches = 0;
+    while (i < na && j < nb) {
+        int x = a[i], y = b[j];
+        matches += x == y;
+        i += x <= y;
+        j += y < x;
+    }
+    return matches;
+}
+
+// Elements of a[0..N) found in b[j..nb), unrolled by the compiler. Same
+// contract as countSortedMatches: j only moves forward, and stays on a match
+// so a repeated job skill counts each time.
+template <int N>
+struct MatchCount {
+    static int count(const int* a, const int* b, int nb, int j) {
+        while (j < nb && b[j] < a[0]) ++j;
+        return (j < nb && b[j] == a[0] ? 1 : 0) + MatchCount<N - 1>::count(a + 1, b, nb, j);
+    }
+};
+
+template <>
+struct MatchCount<0> {
+    static int count(const int*, const int*, int, int) { return 0; }
+};
+
+template <int N>
+inline int scoreFixed(const Job& job, const ResumeGroup& g) {
+    return PERCENT_TABLE.pct[job.skillCount][MatchCount<N>::count(job.skillIds, g.skillIds, g.skillIdCount, 0)];
+}
+
+inline int scoreNone(const Job&, const ResumeGroup&) {
+    return 0;
+}
+
+inline int scoreSorted(const Job& job, const ResumeGroup& g) {
+    return PERCENT_TABLE.pct[job.skillCount][countSortedMatches(job.skillIds, job.skillIdCount, g.skillIds, g.skillIdCount)];
+}
+
+inline ScoreKernel scoreKernelFor(const Job& job) {
+    switch (job.skillIdCount) {
+        case 0: return &scoreNone;
+        case 1: return &scoreFixed<1>;
+        case 2: return &scoreFixed<2>;
+        case 3: return &scoreFixed<3>;
+        case 4: return &scoreFixed<4>;
+        case 5: return &scoreFixed<5>;
+        case 6: return &scoreFixed<6>;
+        case 7: return &scoreFixed<7>;
+        case MAX_UNROLLED_SKILLS: return &scoreFixed<MAX_UNROLLED_SKILLS>;
+        default: return &scoreSorted;
+    }
+}
+
+const long long SCORE_CACHE_MAX_CELLS = 1LL << 26; // 64 MB; larger products are not cached
+const unsigned char SCORE_UNKNOWN = 255;            // scores are 0..100
+
+// Per-thread counters, summed for the hit-rate report
+struct ScoreCacheStats {
+    long long hits;
+    long long misses;
+};
+
+// Cells are filled lazily by whichever thread scores a pair first. Racing
+// threads compute and store the same value, so relaxed atomics suffice.
+struct ScoreCache {
+    std::atomic<unsigned char>* cells; // [jobSig * groups + group]
+    int groups;
+
+    void init() {
+        cells = nullptr;
+        groups = 0;
+    }
+
+    void reset(int jobSigs, int groupCount) {
+        destroy();
+        long long n = (long long)jobSigs * groupCount;
+        if (n == 0 || n > SCORE_CACHE_MAX_CELLS) return;
+        groups = groupCount;
+        cells = new std::atomic<unsigned char>[n];
+        for (long long i = 0; i < n; ++i) cells[i].store(SCORE_UNKNOWN, std::memory_order_relaxed);
+    }
+
+    // compute() runs only on a miss
+    template <class Compute>
+    int get(int jobSig, int group, Compute compute, ScoreCacheStats& stats) {
+        if (!cells) {
+            ++stats.misses;
+            return compute();
+        }
+        std::atomic<unsigned char>& cell = cells[(long long)jobSig * groups + group];
+        unsigned char v = cell.load(std::memory_order_relaxed);
+        if (v != SCORE_UNKNOWN) {
+            ++stats.hits;
+            return v;
+        }
+        ++stats.misses;
+        int sc = compute();
+        cell.store((unsigned char)sc, std::memory_order_relaxed);
+        return sc;
+    }
+
+    void destroy() {
+        delete[] cells;
+        init();
+    }
+};
+
+#endif
@@ -0,0 +1,159 @@
+// sort_primitives.h
+// Reusable sorts over arrays of 32-bit indices (the 'order' of an array table).
+//
+//   radixSortIndices(idx, n, key, descending)           stable LSD radix sort, unsigned int keys
+//   mergeSortIndices(idx, n, less)                      stable bottom-up merge sort
+//   parallelSortParts(n, threads)                       slices worth sorting in parallel (1 = don't)
+//   parallelSortIndices(idx, n, parts, pool, sortSlice, less)
+//                                                       slices sorted by sortSlice on the pool, merged stably
+//
+// All read each element through its index, so the sorted structs never move.
+//
+#ifndef SORT_PRIMITIVES_H
+#define SORT_PRIMITIVES_H
+
+#include "thread_pool.h"
+
+const int RADIX_BITS = 8;
+const int RADIX_BUCKETS = 1 << RADIX_BITS;
+const int MERGE_RUN = 32; // runs this short are insertion sorted first
+// Smallest slice worth a thread. Measured: sorting 1024 indices takes 40-70 us,
+// a 2-way merge pass over them about 1 us and queueing a pool task under 1 us,
+// so a slice this long outweighs waking a sleeping worker (tens of us).
+// Shorter slices (512: about 6 us) would not.
+const int PARALLEL_SORT_CUTOFF = 1 << 10;
+
+// Keys are read once into a side array; passes stop once the remaining key
+// bits are all zero, so small keys (skill counts, scores) take one pass.
+template <class KeyFn>
+void radixSortIndices(int* idx, int n, KeyFn key, bool descending) {
+    if (n < 2) return;
+    unsigned int* keys = new unsigned int[n];
+    unsigned int* keysTmp = new unsigned int[n];
+    int* idxTmp = new int[n];
+
+    unsigned int maxKey = 0;
+    for (int i = 0; i < n; ++i) {
+        keys[i] = key(idx[i]);
+        if (keys[i] > maxKey) maxKey = keys[i];
+    }
+    if (descending) {
+        for (int i = 0; i < n; ++i) keys[i] = maxKey - keys[i];
+    }
+
+    unsigned int* srcKeys = keys;
+    unsigned int* dstKeys = keysTmp;
+    int* srcIdx = idx;
+    int* dstIdx = idxTmp;
+    for (int shift = 0; shift < 32 && (maxKey >> shift) != 0; shift += RADIX_BITS) {
+        int pos[RADIX_BUCKETS + 1] = {0};
+        for (int i = 0; i < n; ++i) ++pos[((srcKeys[i] >> shift) & (RADIX_BUCKETS - 1)) + 1];
+        for (int b = 0; b < RADIX_BUCKETS; ++b) pos[b + 1] += pos[b];
+        for (int i = 0; i < n; ++i) {
+            int p = pos[(srcKeys[i] >> shift) & (RADIX_BUCKETS - 1)]++;
+            dstKeys[p] = srcKeys[i];
+            dstIdx[p] = srcIdx[i];
+        }
+        unsigned int* tk = srcKeys; srcKeys = dstKeys; dstKeys = tk;
+        int* ti = srcIdx; srcIdx = dstIdx; dstIdx = ti;
+    }
+    if (srcIdx != idx) {
+        for (int i = 0; i < n; ++i) idx[i] = srcIdx[i];
+    }
+
+    delete[] keys;
+    delete[] keysTmp;
+    delete[] idxTmp;
+}
+
+// Stable merge of src[lo, mid) and src[mid, hi) into dst[lo, hi)
+template <class Less>
+void mergeRuns(const int* src, int* dst, int lo, int mid, int hi, Less less) {
+    int i = lo, j = mid, k = lo;
+    while (i < mid && j < hi) {
+        if (less(src[j], src[i])) dst[k++] = src[j++];
+        else dst[k++] = src[i++];
+    }
+    while (i < mid) dst[k++] = src[i++];
+    while (j < hi) dst[k++] = src[j++];
+}
+
+// Insertion sorts runs of MERGE_RUN, then merges runs pairwise, ping-ponging
+// between idx and one scratch buffer
+template <class Less>
+void mergeSortIndices(int* idx, int n, Less less) {
+    if (n < 2) return;
+    for (int lo = 0; lo < n; lo += MERGE_RUN) {
+        int hi = lo + MERGE_RUN < n ? lo + MERGE_RUN : n;
+        for (int i = lo + 1; i < hi; ++i) {
+            int v = idx[i];
+            int j = i - 1;
+            while (j >= lo && less(v, idx[j])) {
+                idx[j + 1] = idx[j];
+                --j;
+            }
+            idx[j + 1] = v;
+        }
+    }
+    if (n <= MERGE_RUN) return;
+
+    int* tmp = new int[n];
+    int* src = idx;
+    int* dst = tmp;
+    for (int width = MERGE_RUN; width < n; width *= 2) {
+        for (int lo = 0; lo < n; lo += 2 * width) {
+            int mid = lo + width < n ? lo + width : n;
+            int hi = lo + 2 * width < n ? lo + 2 * width : n;
+            mergeRuns(src, dst, lo, mid, hi, less);
+        }
+        int* t = src; src = dst; dst = t;
+    }
+    if (src != idx) {
+        for (int i = 0; i < n; ++i) idx[i] = src[i];
+    }
+    delete[] tmp;
+}
+
+// One slice per thread, each at least PARALLEL_SORT_CUTOFF long
+inline int parallelSortParts(int n, int threads) {
+    int parts = threads;
+    if (parts > n / PARALLEL_SORT_CUTOFF) parts = n / PARALLEL_SORT_CUTOFF;
+    return parts < 2 ? 1 : parts;
+}
+
+// Each pool task sorts one fixed slice with sortSlice(sliceIdx, sliceLen), then
+// slices are merged pairwise, one task per pair. Slice bounds depend only on n
+// and parts, and the merges are stable, so with a stable sortSlice the result
+// equals a stable sort of the whole array for any thread count.
+template <class SortSlice, class Less>
+void parallelSortIndices(int* idx, int n, int parts, ThreadPool& pool, SortSlice sortSlice, Less less) {
+    int* bounds = new int[parts + 1];
+    for (int p = 0; p <= parts; ++p) bounds[p] = (int)((long long)n * p / parts);
+    pool.parallelFor(0, parts, 1, [&](int lo, int hi, int) {
+        for (int p = lo; p < hi; ++p) sortSlice(idx + bounds[p], bounds[p + 1] - bounds[p]);
+    });
+
+    int* tmp = new int[n];
+    int* src = idx;
+    int* dst = tmp;
+    for (int width = 1; width < parts; width *= 2) {
+        int pairs = (parts + 2 * width - 1) / (2 * width);
+        pool.parallelFor(0, pairs, 1, [&](int first, int last, int) {
+            for (int q = first; q < last; ++q) {
+                int lo = q * 2 * width;
+                int mid = lo + width < parts ? lo + width : parts;
+                int hi = lo + 2 * width < parts ? lo + 2 * width : parts;
+                mergeRuns(src, dst, bounds[lo], bounds[mid], bounds[hi], less);
+            }
+        });
+        int* t = src; src = dst; dst = t;
+    }
+    if (src != idx) {
+        for (int i = 0; i < n; ++i) idx[i] = src[i];
+    }
+
+    delete[] tmp;
+    delete[] bounds;
+}
+
+#endif
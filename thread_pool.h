@@ -0,0 +1,203 @@
+// thread_pool.h
+// Small work-stealing thread pool used by the engine's parallel steps.
+//
+//   ThreadPool pool;
+//   pool.init(threads);                      // threads - 1 workers + the calling thread
+//   pool.parallelFor(0, n, grain, [&](int lo, int hi, int worker) { ... });
+//   TaskGroup g; pool.run(g, task); ... pool.wait(g);   // fork / join
+//   pool.destroy();
+//
+// Every thread owns a deque. A thread pushes and pops its own tasks at the
+// bottom; idle threads steal from the top of the others. The thread that calls
+// wait() (or parallelFor) runs tasks too, so nothing blocks while work is queued.
+// The 'worker' index (0 = calling thread) lets callers keep per-thread scratch.
+//
+#ifndef THREAD_POOL_H
+#define THREAD_POOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+typedef std::function<void(int worker)> PoolTask;
+
+// Tasks forked together; wait() returns once all of them have finished
+struct TaskGroup {
+    std::atomic<int> pending;
+
+    TaskGroup() : pending(0) {}
+};
+
+struct PoolJob {
+    PoolTask task;
+    TaskGroup* group;
+};
+
+// Growable ring buffer guarded by a mutex: the owner uses the bottom,
+// thieves take from the top
+struct TaskDeque {
+    std::mutex lock;
+    PoolJob* ring;
+    int capacity;
+    int top;    // index of the oldest job
+    int count;
+
+    void init() {
+        capacity = 64;
+        ring = new PoolJob[capacity];
+        top = 0;
+        count = 0;
+    }
+
+    void pushBottom(PoolJob&& job) {
+        std::lock_guard<std::mutex> guard(lock);
+        if (count == capacity) {
+            PoolJob* bigger = new PoolJob[capacity * 2];
+            for (int i = 0; i < count; ++i) bigger[i] = std::move(ring[(top + i) % capacity]);
+            delete[] ring;
+            ring = bigger;
+            capacity *= 2;
+            top = 0;
+        }
+        ring[(top + count) % capacity] = std::move(job);
+        ++count;
+    }
+
+    bool popBottom(PoolJob& out) {
+        std::lock_guard<std::mutex> guard(lock);
+        if (count == 0) return false;
+        --count;
+        out = std::move(ring[(top + count) % capacity]);
+        return true;
+    }
+
+    bool stealTop(PoolJob& out) {
+        std::lock_guard<std::mutex> guard(lock);
+        if (count == 0) return false;
+        out = std::move(ring[top]);
+        top = (top + 1) % capacity;
+        --count;
+        return true;
+    }
+
+    void destroy() {
+        delete[] ring;
+        ring = nullptr;
+        count = 0;
+    }
+};
+
+class ThreadPool {
+public:
+    void init(int threads) {
+        size_ = threads > 0 ? threads : 1;
+        deques_ = new TaskDeque[size_];
+        for (int i = 0; i < size_; ++i) deques_[i].init();
+        queued_ = 0;
+        stopping_ = false;
+        workers_ = new std::thread[size_];
+        for (int i = 1; i < size_; ++i) {
+            workers_[i] = std::thread([this, i]() { workerLoop(i); });
+        }
+    }
+
+    void destroy() {
+        {
+            std::lock_guard<std::mutex> guard(sleepLock_);
+            stopping_ = true;
+        }
+        wake_.notify_all();
+        for (int i = 1; i < size_; ++i) workers_[i].join();
+        for (int i = 0; i < size_; ++i) deques_[i].destroy();
+        delete[] workers_;
+        delete[] deques_;
+        workers_ = nullptr;
+        deques_ = nullptr;
+    }
+
+    int size() const { return size_; }
+
+    // Queues a task on the current thread's deque
+    void run(TaskGroup& group, PoolTask task) {
+        group.pending.fetch_add(1);
+        deques_[currentWorker()].pushBottom(PoolJob{std::move(task), &group});
+        {
+            std::lock_guard<std::mutex> guard(sleepLock_);
+            ++queued_;
+        }
+        wake_.notify_one();
+    }
+
+    // Runs queued tasks until every task of the group has finished
+    void wait(TaskGroup& group) {
+        int self = currentWorker();
+        while (group.pending.load() > 0) {
+            if (!runOne(self)) std::this_thread::yield();
+        }
+    }
+
+    // body(lo, hi, worker) over [begin, end) in chunks of at most 'grain'
+    template <class Body>
+    void parallelFor(int begin, int end, int grain, Body body) {
+        if (grain < 1) grain = 1;
+        if (size_ == 1 || end - begin <= grain) {
+            if (begin < end) body(begin, end, currentWorker());
+            return;
+        }
+        TaskGroup group;
+        for (int lo = begin; lo < end; lo += grain) {
+            int hi = lo + grain < end ? lo + grain : end;
+            run(group, [lo, hi, &body](int worker) { body(lo, hi, worker); });
+        }
+        wait(group);
+    }
+
+private:
+    int size_;
+    TaskDeque* deques_;
+    std::thread* workers_;
+    std::mutex sleepLock_;
+    std::condition_variable wake_;
+    int queued_;      // jobs pushed and not yet taken, guarded by sleepLock_
+    bool stopping_;
+
+    // Index of the calling thread's deque: pool workers set it, other threads use 0
+    static int& currentWorker() {
+        static thread_local int index = 0;
+        return index;
+    }
+
+    bool take(int self, PoolJob& job) {
+        if (deques_[self].popBottom(job)) return true;
+        for (int k = 1; k < size_; ++k) {
+            if (deques_[(self + k) % size_].stealTop(job)) return true;
+        }
+        return false;
+    }
+
+    bool runOne(int self) {
+        PoolJob job;
+        if (!take(self, job)) return false;
+        {
+            std::lock_guard<std::mutex> guard(sleepLock_);
+            --queued_;
+        }
+        job.task(self);
+        job.group->pending.fetch_sub(1);
+        return true;
+    }
+
+    void workerLoop(int self) {
+        currentWorker() = self;
+        while (true) {
+            if (runOne(self)) continue;
+            std::unique_lock<std::mutex> guard(sleepLock_);
+            wake_.wait(guard, [this]() { return stopping_ || queued_ > 0; });
+            if (stopping_ && queued_ == 0) return;
+        }
+    }
+};
+
+#endif
@@ -0,0 +1,297 @@
+// title_index.h
+// Indexes over normalized job titles: trigrams for substring search and a
+// radix trie for prefix lookup and autocomplete.
+//
+//   TitleGramIndex index;
+//   index.init();
+//   index.add(job.titleNorm, pos);            // pos = job's place in title order, ascending
+//   index.find(qNorm, n, titleAt, out);       // positions whose title contains qNorm
+//   index.destroy();
+//
+// Every 3-byte window of a title is packed into one int and maps to the sorted
+// list of positions containing it. A query of 3+ characters intersects the
+// lists of its own trigrams, shortest first, and checks each survivor with a
+// real find() on the stored title, so the result is exact. Shorter queries have
+// no trigram and scan the stored titles instead. Results come out in title order.
+//
+//   TitleTrie trie;
+//   trie.build(n, titleAt, scoreAt);          // once, after the scores are known
+//   int node = trie.findPrefix(pNorm, titleAt);
+//   trie.nodes.data[node].top / lo / hi       // best titles / jobs under the prefix
+//
+// A compact radix trie over the same normalized titles (base title + group
+// number) for autocomplete. 'sorted' lists the job positions by normalized
+// title, so every node covers one range [lo, hi) of it, and each node caches
+// its TRIE_TOP best distinct titles by score. A lookup walks at most one node
+// per branching character and never visits the jobs themselves.
+//
+#ifndef TITLE_INDEX_H
+#define TITLE_INDEX_H
+
+#include "engine_common.h"
+#include "sort_primitives.h"
+
+const int TITLE_GRAM = 3;
+const int TRIE_TOP = 5; // suggestions cached per trie node
+
+inline unsigned int packGram(const std::string& s, size_t at) {
+    return ((unsigned int)(unsigned char)s[at] << 16) |
+           ((unsigned int)(unsigned char)s[at + 1] << 8) |
+           (unsigned int)(unsigned char)s[at + 2];
+}
+
+struct TitleGramIndex {
+    struct Bucket {
+        unsigned int gram;
+        bool used;
+        DynArray<int> positions;
+    };
+
+    Bucket* buckets; // open addressing, power-of-two capacity
+    int capacity;
+    int used;
+
+    void init() {
+        capacity = 1024;
+        used = 0;
+        buckets = new Bucket[capacity];
+        for (int i = 0; i < capacity; ++i) buckets[i].used = false;
+    }
+
+    // Positions must be added in ascending order; a title repeating a trigram
+    // is listed once
+    void add(const std::string& titleNorm, int pos) {
+        for (size_t i = 0; i + TITLE_GRAM <= titleNorm.size(); ++i) {
+            DynArray<int>& list = slot(packGram(titleNorm, i));
+            if (list.size == 0 || list.data[list.size - 1] != pos) list.push(pos);
+        }
+    }
+
+    const DynArray<int>* get(unsigned int gram) const {
+        int at = probe(gram);
+        return buckets[at].used ? &buckets[at].positions : nullptr;
+    }
+
+    // titleAt(pos) returns the normalized title at each of the n positions
+    template <class TitleAt>
+    void find(const std::string& qNorm, int n, TitleAt titleAt, DynArray<int>& out) const {
+        out.clear();
+        if (qNorm.empty()) return;
+        if (qNorm.size() < (size_t)TITLE_GRAM) {
+            for (int p = 0; p < n; ++p) {
+                if (titleAt(p).find(qNorm) != std::string::npos) out.push(p);
+            }
+            return;
+        }
+
+        // The rarest trigram drives the scan; the others are checked by merging
+        const DynArray<int>* lists[MAX_TITLE_GRAMS];
+        int listCount = 0;
+        for (size_t i = 0; i + TITLE_GRAM <= qNorm.size() && listCount < MAX_TITLE_GRAMS; ++i) {
+            const DynArray<int>* list = get(packGram(qNorm, i));
+            if (!list) return; // a trigram no title has
+            bool repeated = false;
+            for (int k = 0; k < listCount && !repeated; ++k) repeated = lists[k] == list;
+            if (!repeated) lists[listCount++] = list;
+        }
+        for (int k = 1; k < listCount; ++k) {
+            const DynArray<int>* v = lists[k];
+            int j = k - 1;
+            while (j >= 0 && lists[j]->size > v->size) {
+                lists[j + 1] = lists[j];
+                --j;
+            }
+            lists[j + 1] = v;
+        }
+
+        int cursor[MAX_TITLE_GRAMS] = {0};
+        const DynArray<int>& driver = *lists[0];
+        for (int i = 0; i < driver.size; ++i) {
+            int pos = driver.data[i];
+            bool inAll = true;
+            for (int k = 1; k < listCount && inAll; ++k) {
+                const DynArray<int>& other = *lists[k];
+                while (cursor[k] < other.size && other.data[cursor[k]] < pos) ++cursor[k];
+                inAll = cursor[k] < other.size && other.data[cursor[k]] == pos;
+            }
+            if (inAll && titleAt(pos).find(qNorm) != std::string::npos) out.push(pos);
+        }
+    }
+
+    void destroy() {
+        if (!buckets) return;
+        for (int i = 0; i < capacity; ++i) {
+            if (buckets[i].used) buckets[i].positions.destroy();
+        }
+        delete[] buckets;
+        buckets = nullptr;
+        capacity = used = 0;
+    }
+
+private:
+    static const int MAX_TITLE_GRAMS = 32; // longer queries intersect their first 32
+
+    int probe(unsigned int gram) const {
+        unsigned int at = (gram * 2654435761u) & (unsigned int)(capacity - 1);
+        while (buckets[at].used && buckets[at].gram != gram) at = (at + 1) & (unsigned int)(capacity - 1);
+        return (int)at;
+    }
+
+    DynArray<int>& slot(unsigned int gram) {
+        int at = probe(gram);
+        if (buckets[at].used) return buckets[at].positions;
+        if (2 * (used + 1) > capacity) {
+            grow();
+            at = probe(gram);
+        }
+        buckets[at].used = true;
+        buckets[at].gram = gram;
+        buckets[at].positions.init(4);
+        ++used;
+        return buckets[at].positions;
+    }
+
+    // Posting arrays move by pointer, not by copy
+    void grow() {
+        Bucket* old = buckets;
+        int oldCapacity = capacity;
+        capacity *= 2;
+        buckets = new Bucket[capacity];
+        for (int i = 0; i < capacity; ++i) buckets[i].used = false;
+        for (int i = 0; i < oldCapacity; ++i) {
+            if (!old[i].used) continue;
+            int at = probe(old[i].gram);
+            buckets[at] = old[i];
+        }
+        delete[] old;
+    }
+};
+
+struct TitleTrie {
+    struct Node {
+        int lo, hi;        // jobs sorted[lo, hi) share this node's prefix
+        int depth;         // prefix length; the label is title[parent depth, depth)
+        int firstChild;
+        int nextSibling;
+        int topCount;
+        int top[TRIE_TOP]; // positions of the best distinct titles, best first
+    };
+
+    DynArray<Node> nodes; // nodes.data[0] is the root
+    int* sorted;          // job positions ordered by normalized title
+    int count;
+
+    void init() {
+        nodes.init(256);
+        sorted = nullptr;
+        count = 0;
+    }
+
+    // titleAt(pos) is the normalized title, scoreAt(pos) ranks suggestions;
+    // equal scores keep the lower position (earlier in title order)
+    template <class TitleAt, class ScoreAt>
+    void build(int n, TitleAt titleAt, ScoreAt scoreAt) {
+        nodes.clear();
+        delete[] sorted;
+        count = n;
+        sorted = new int[n > 0 ? n : 1];
+        for (int i = 0; i < n; ++i) sorted[i] = i;
+        mergeSortIndices(sorted, n, [&](int a, int b) { return titleAt(a) < titleAt(b); });
+        if (n > 0) buildNode(0, n, titleAt, scoreAt);
+    }
+
+    // Node whose subtree holds exactly the titles starting with pNorm, or -1
+    template <class TitleAt>
+    int findPrefix(const std::string& pNorm, TitleAt titleAt) const {
+        if (nodes.size == 0) return -1;
+        int at = 0;
+        size_t matched = 0;
+        while (true) {
+            const Node& node = nodes.data[at];
+            const std::string& label = titleAt(sorted[node.lo]);
+            while (matched < (size_t)node.depth && matched < pNorm.size()) {
+                if (label[matched] != pNorm[matched]) return -1;
+                ++matched;
+            }
+            if (matched == pNorm.size()) return at;
+            int child = node.firstChild;
+            while (child >= 0 && titleAt(sorted[nodes.data[child].lo])[node.depth] != pNorm[matched]) {
+                child = nodes.data[child].nextSibling;
+            }
+            if (child < 0) return -1;
+            at = child;
+        }
+    }
+
+    void destroy() {
+        nodes.destroy();
+        delete[] sorted;
+        sorted = nullptr;
+        count = 0;
+    }
+
+private:
+    // The range shares its first and last title's common prefix; titles ending
+    // there sit at the front, the rest split by their next character
+    template <class TitleAt, class ScoreAt>
+    int buildNode(int lo, int hi, TitleAt& titleAt, ScoreAt& scoreAt) {
+        const std::string& first = titleAt(sorted[lo]);
+        const std::string& last = titleAt(sorted[hi - 1]);
+        size_t d = 0;
+        while (d < first.size() && d < last.size() && first[d] == last[d]) ++d;
+
+        Node node;
+        node.lo = lo;
+        node.hi = hi;
+        node.depth = (int)d;
+        node.firstChild = node.nextSibling = -1;
+        node.topCount = 0;
+        int self = nodes.size;
+        nodes.push(node); // nodes.data may move below, so refer to nodes by index
+
+        int i = lo;
+        while (i < hi && titleAt(sorted[i]).size() == d) offerTop(self, sorted[i++], titleAt, scoreAt);
+        int prevChild = -1;
+        while (i < hi) {
+            char c = titleAt(sorted[i])[d];
+            int j = i + 1;
+            while (j < hi && titleAt(sorted[j])[d] == c) ++j;
+            int child = buildNode(i, j, titleAt, scoreAt);
+            if (prevChild < 0) nodes.data[self].firstChild = child;
+            else nodes.data[prevChild].nextSibling = child;
+            prevChild = child;
+            // A title lives in one subtree only, so the children's lists suffice
+            for (int k = 0; k < nodes.data[child].topCount; ++k) {
+                offerTop(self, nodes.data[child].top[k], titleAt, scoreAt);
+            }
+            i = j;
+        }
+        return self;
+    }
+
+    template <class TitleAt, class ScoreAt>
+    void offerTop(int at, int pos, TitleAt& titleAt, ScoreAt& scoreAt) {
+        Node& node = nodes.data[at];
+        auto better = [&](int a, int b) {
+            int sa = scoreAt(a), sb = scoreAt(b);
+            return sa != sb ? sa > sb : a < b;
+        };
+        // Duplicate titles keep their best job only
+        for (int k = 0; k < node.topCount; ++k) {
+            if (titleAt(node.top[k]) != titleAt(pos)) continue;
+            if (!better(pos, node.top[k])) return;
+            for (int m = k; m + 1 < node.topCount; ++m) node.top[m] = node.top[m + 1];
+            --node.topCount;
+            break;
+        }
+        int k = node.topCount;
+        while (k > 0 && better(pos, node.top[k - 1])) --k;
+        if (k >= TRIE_TOP) return;
+        int end = node.topCount < TRIE_TOP ? node.topCount : TRIE_TOP - 1;
+        for (int m = end; m > k; --m) node.top[m] = node.top[m - 1];
+        node.top[k] = pos;
+        if (node.topCount < TRIE_TOP) ++node.topCount;
+    }
+};
+
+#endif